@@ -0,0 +1,148 @@
+"""Pack the OLED slices from progmem_anim.c into one locality-ordered atlas.
+
+Separate PROGMEM arrays land wherever the linker puts them, so frames that are
+drawn in the same tick can end up far apart in flash. This emits a single blob
+with co-accessed frames next to each other, plus an offset per slice, and
+prints a cache-line model comparing the layouts. Frames drawn every tick go in
+asset_atlas, which HOT_DATA() places in SRAM on the RP2040; boot frames and
+anything else cold go in asset_atlas_cold and stay in flash.
+
+    python build_atlas.py keyboards/boardsource/lulu/keymaps/kbdd
+"""
+
+import argparse
+import os
+import re
+
+ARRAY_RE = re.compile(r"const uint8_t PROGMEM (\w+)\[\] = \{(.*?)\};", re.DOTALL)
+BYTE_RE = re.compile(r"0x[0-9a-fA-F]{2}")
+
+FRAMES = range(4)
+
+# Drawn every master tick in this order (see tick_widgets())
+MODIFIERS = ["super", "alt", "shift", "ctrl"]
+LAYERS = ["qwerty", "gaming", "unicode", "symbol", "navigation", "function"]
+
+# Drawn together by draw_clock() and draw_wpm_digits()
+CLOCK = [f"digit_{d}" for d in range(10)] + ["colon", "am", "pm"]
+
+
+def hot_order(names):
+    # Interleave sprites by frame: at rest every sprite sits on the same frame,
+    # so one tick reads a single contiguous run.
+    order = [f"{sprite}_{frame}" for frame in FRAMES for sprite in MODIFIERS]
+    order += [f"{layer}_{frame}" for frame in FRAMES for layer in LAYERS]
+    order += CLOCK
+    return [name for name in order if name in names]
+
+
+def co_access_order(names):
+    # Boot frames and anything new are cold; keep their source order
+    hot = hot_order(names)
+    return hot + [name for name in names if name not in hot]
+
+
+def parse(path):
+    with open(path) as f:
+        source = f.read()
+    return {name: [int(b, 16) for b in BYTE_RE.findall(body)] for name, body in ARRAY_RE.findall(source)}
+
+
+def layout(order, slices):
+    offsets, offset = {}, 0
+    for name in order:
+        offsets[name] = offset
+        offset += len(slices[name])
+    return offsets
+
+
+def lines_touched(names, offsets, slices, line_size):
+    lines = set()
+    for name in names:
+        start = offsets[name]
+        end = start + len(slices[name])
+        lines.update(range(start // line_size, (end - 1) // line_size + 1))
+    return len(lines)
+
+
+def report(slices, source_order, atlas_order):
+    source = layout(source_order, slices)
+    atlas = layout(atlas_order, slices)
+
+    # Steady-state frames: every toggle sprite at rest on frame 0, except the
+    # active layer (frame 3), plus a full set of clock glyphs.
+    scenarios = {
+        "master idle": [f"{m}_0" for m in MODIFIERS] + ["qwerty_3"] + [f"{l}_0" for l in LAYERS[1:]],
+        "master shift": [f"{m}_0" for m in MODIFIERS if m != "shift"] + ["shift_3", "qwerty_3"] + [f"{l}_0" for l in LAYERS[1:]],
+        "clock": CLOCK,
+    }
+
+    # RP2040 XIP cache lines are 8 bytes; 32 covers a QSPI burst
+    print(f"{'scenario':<14} {'bytes':>6} " + " ".join(f"{f'{n}B src/atlas':>16}" for n in (8, 32)))
+    for label, names in scenarios.items():
+        names = [n for n in names if n in slices]
+        size = sum(len(slices[n]) for n in names)
+        cells = []
+        for line_size in (8, 32):
+            before = lines_touched(names, source, slices, line_size)
+            after = lines_touched(names, atlas, slices, line_size)
+            cells.append(f"{f'{before}/{after}':>16}")
+        print(f"{label:<14} {size:>6} " + " ".join(cells))
+
+
+def write_array(f, names, slices, offsets, attribute):
+    f.write(f"const uint8_t {attribute}[] = {{\n")
+    for name in names:
+        data = slices[name]
+        f.write(f"    // {name} @ {offsets[name]} ({len(data)} bytes)\n")
+        for i in range(0, len(data), 16):
+            f.write("    " + " ".join(f"0x{b:02x}," for b in data[i : i + 16]) + "\n")
+    f.write("};\n")
+
+
+def emit(keymap_dir, slices, order):
+    hot = hot_order(order)
+    cold = [name for name in order if name not in hot]
+    offsets = layout(hot, slices)
+    offsets.update(layout(cold, slices))
+
+    with open(os.path.join(keymap_dir, "progmem_atlas.h"), "w") as f:
+        f.write("#pragma once\n\n")
+        f.write("// Generated by build_atlas.py from progmem_anim.c, do not edit.\n\n")
+        f.write("#include QMK_KEYBOARD_H\n\n")
+        f.write("extern const uint8_t asset_atlas[];\n")
+        f.write("extern const uint8_t PROGMEM asset_atlas_cold[];\n\n")
+        f.write("#define ATLAS(name) (ATLAS_BASE_##name + ATLAS_OFFSET_##name)\n\n")
+        for name in order:
+            base = "asset_atlas" if name in hot else "asset_atlas_cold"
+            f.write(f"#define ATLAS_BASE_{name} {base}\n")
+            f.write(f"#define ATLAS_OFFSET_{name} {offsets[name]}\n")
+
+    with open(os.path.join(keymap_dir, "progmem_atlas.c"), "w") as f:
+        f.write("// Generated by build_atlas.py from progmem_anim.c, do not edit.\n\n")
+        f.write("#include QMK_KEYBOARD_H\n")
+        f.write('#include "progmem_atlas.h"\n')
+        f.write('#include "hot_path.h"\n\n')
+        f.write("// Drawn every tick, in SRAM on the RP2040\n")
+        write_array(f, hot, slices, offsets, "HOT_DATA(asset_atlas)")
+        f.write("\n// Boot animation and other cold frames\n")
+        write_array(f, cold, slices, offsets, "PROGMEM asset_atlas_cold")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("keymap_dir")
+    parser.add_argument("--report-only", action="store_true", help="print the cache model without writing files")
+    args = parser.parse_args()
+
+    slices = parse(os.path.join(args.keymap_dir, "progmem_anim.c"))
+    source_order = list(slices)
+    atlas_order = co_access_order(source_order)
+
+    report(slices, source_order, atlas_order)
+    if not args.report_only:
+        emit(args.keymap_dir, slices, atlas_order)
+
+
+if __name__ == "__main__":
+    main()
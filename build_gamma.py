@@ -0,0 +1,51 @@
+"""Generate the gamma table used by the keymap's LED output stage.
+
+Indicator colours are authored in perceptual terms (HSV value, lumino
+brightness), but LED current is linear in PWM duty, so dim levels look
+crushed. This writes a 256-entry PROGMEM table mapping perceptual to linear
+duty, which the output stage folds together with brightness scaling.
+
+    python build_gamma.py keyboards/boardsource/lulu/keymaps/kbdd --gamma 2.2
+"""
+
+import argparse
+import os
+
+
+def table(gamma):
+    return [round(((i / 255) ** gamma) * 255) for i in range(256)]
+
+
+def emit(keymap_dir, gamma, values):
+    with open(os.path.join(keymap_dir, "gamma_lut.h"), "w") as f:
+        f.write("#pragma once\n\n")
+        f.write(f"// Generated by build_gamma.py (gamma {gamma}), do not edit.\n\n")
+        f.write("#include QMK_KEYBOARD_H\n\n")
+        f.write("extern const uint8_t PROGMEM gamma_lut[256];\n")
+
+    with open(os.path.join(keymap_dir, "gamma_lut.c"), "w") as f:
+        f.write(f"// Generated by build_gamma.py (gamma {gamma}), do not edit.\n\n")
+        f.write("#include QMK_KEYBOARD_H\n")
+        f.write('#include "gamma_lut.h"\n\n')
+        f.write("const uint8_t PROGMEM gamma_lut[256] = {\n")
+        for i in range(0, 256, 16):
+            f.write("    " + " ".join(f"{v:3d}," for v in values[i : i + 16]) + "\n")
+        f.write("};\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("keymap_dir")
+    parser.add_argument("--gamma", type=float, default=2.2)
+    args = parser.parse_args()
+
+    values = table(args.gamma)
+    emit(args.keymap_dir, args.gamma, values)
+
+    # Lowest input that still lights the LED
+    first = next(i for i, v in enumerate(values) if v)
+    print(f"gamma {args.gamma}: 256 entries, first non-zero output at input {first}")
+
+
+if __name__ == "__main__":
+    main()
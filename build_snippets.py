@@ -0,0 +1,172 @@
+"""Generate the snippet trie used by the keymap's text expansion.
+
+Reads abbreviation/expansion pairs from snippets.txt in the keymap and writes
+them as a double-array trie in PROGMEM: every keystroke is one base + symbol
+lookup and one check compare, however many snippets there are.
+
+    python build_snippets.py keyboards/boardsource/lulu/keymaps/kbdd
+
+snippets.txt has one snippet per line, the abbreviation and then the
+expansion after whitespace. Expansions may use \\n, \\t and \\\\. Lines
+starting with # are comments. Abbreviations are matched without regard to
+case and none may be a prefix of another, since a snippet fires as soon as
+its last key is typed.
+"""
+
+import argparse
+import os
+import sys
+
+# Unshifted US layout: character -> HID keycode
+KEYCODES = {chr(ord("a") + i): 0x04 + i for i in range(26)}
+KEYCODES.update({str((i + 1) % 10): 0x1E + i for i in range(10)})
+KEYCODES.update({"-": 0x2D, "=": 0x2E, "[": 0x2F, "]": 0x30, "\\": 0x31, ";": 0x33, "'": 0x34, "`": 0x35, ",": 0x36, ".": 0x37, "/": 0x38})
+KEYCODE_LIMIT = max(KEYCODES.values()) + 1
+
+NO_CHECK = 0xFFFF
+LEAF = 0x8000
+
+
+def parse(path):
+    snippets = []
+    with open(path, encoding="utf-8") as f:
+        for number, line in enumerate(f, 1):
+            line = line.rstrip("\n")
+            if not line.strip() or line.startswith("#"):
+                continue
+
+            parts = line.split(None, 1)
+            if len(parts) != 2:
+                sys.exit(f"{path}:{number}: expected an abbreviation and an expansion")
+
+            abbrev, text = parts[0].lower(), parts[1]
+            text = text.replace("\\\\", "\0").replace("\\n", "\n").replace("\\t", "\t").replace("\0", "\\")
+            if any(c not in KEYCODES for c in abbrev):
+                sys.exit(f"{path}:{number}: '{abbrev}' has characters without an unshifted key")
+            if any(ord(c) >= 128 for c in text):
+                sys.exit(f"{path}:{number}: expansion has characters SEND_STRING cannot type")
+            snippets.append((abbrev, text))
+
+    for a, _ in snippets:
+        for b, _ in snippets:
+            if a != b and b.startswith(a):
+                sys.exit(f"'{a}' is a prefix of '{b}'")
+    if len({a for a, _ in snippets}) != len(snippets):
+        sys.exit("duplicate abbreviation")
+    return snippets
+
+
+def build(snippets):
+    symbols = {c: i + 1 for i, c in enumerate(sorted({c for a, _ in snippets for c in a}))}
+
+    # Plain trie first: node -> {symbol: child}, plus leaf -> snippet index
+    children, leaves = [{}], {}
+    for index, (abbrev, _) in enumerate(snippets):
+        node = 0
+        for c in abbrev:
+            node = children[node].setdefault(symbols[c], len(children))
+            if node == len(children):
+                children.append({})
+        leaves[node] = index
+
+    # Place children breadth-first at the lowest base where all their slots
+    # are free
+    base, check = [0], [NO_CHECK]
+    slot = {0: 0}
+    queue = [0]
+    while queue:
+        node = queue.pop(0)
+        syms = sorted(children[node])
+        if node in leaves:
+            base[slot[node]] = LEAF | leaves[node]
+            continue
+
+        b = 0
+        while any(b + s < len(check) and check[b + s] != NO_CHECK for s in syms):
+            b += 1
+        grow = b + syms[-1] + 1 - len(check)
+        if grow > 0:
+            base += [0] * grow
+            check += [NO_CHECK] * grow
+
+        base[slot[node]] = b
+        for s in syms:
+            check[b + s] = slot[node]
+            slot[children[node][s]] = b + s
+            queue.append(children[node][s])
+
+    if len(base) > LEAF:
+        sys.exit("trie too large for 15-bit node indexes")
+    return symbols, base, check
+
+
+def c_string(text):
+    out = ""
+    for c in text:
+        out += {"\n": "\\n", "\t": "\\t", "\b": "\\b", '"': '\\"', "\\": "\\\\"}.get(c, c)
+    return f'"{out}"'
+
+
+def emit(keymap_dir, snippets, symbols, base, check):
+    with open(os.path.join(keymap_dir, "snippet_trie.h"), "w") as f:
+        f.write("#pragma once\n\n")
+        f.write("// Generated by build_snippets.py from snippets.txt, do not edit.\n\n")
+        f.write("#include QMK_KEYBOARD_H\n\n")
+        f.write(f"#define SNIPPET_NODE_COUNT {len(base)}\n")
+        f.write(f"#define SNIPPET_KEYCODE_LIMIT 0x{KEYCODE_LIMIT:02X}\n")
+        f.write(f"#define SNIPPET_NO_CHECK 0x{NO_CHECK:04X}\n")
+        f.write(f"#define SNIPPET_LEAF 0x{LEAF:04X}\n\n")
+        f.write("typedef struct {\n")
+        f.write("    uint16_t base; // children at base + symbol; SNIPPET_LEAF | snippet for leaves\n")
+        f.write("    uint16_t check; // parent node\n")
+        f.write("} snippet_node_t;\n\n")
+        f.write("extern const uint8_t PROGMEM        snippet_symbol[SNIPPET_KEYCODE_LIMIT];\n")
+        f.write("extern const snippet_node_t PROGMEM snippet_trie[SNIPPET_NODE_COUNT];\n")
+        f.write("extern const char *const PROGMEM    snippet_text[];\n")
+
+    by_keycode = [0] * KEYCODE_LIMIT
+    for c, s in symbols.items():
+        by_keycode[KEYCODES[c]] = s
+
+    with open(os.path.join(keymap_dir, "snippet_trie.c"), "w") as f:
+        f.write("// Generated by build_snippets.py from snippets.txt, do not edit.\n\n")
+        f.write("#include QMK_KEYBOARD_H\n")
+        f.write('#include "snippet_trie.h"\n\n')
+        f.write("const uint8_t PROGMEM snippet_symbol[SNIPPET_KEYCODE_LIMIT] = {\n")
+        for i in range(0, KEYCODE_LIMIT, 16):
+            f.write("    " + " ".join(f"{v:2d}," for v in by_keycode[i : i + 16]) + "\n")
+        f.write("};\n\n")
+
+        f.write("const snippet_node_t PROGMEM snippet_trie[SNIPPET_NODE_COUNT] = {\n")
+        for b, c in zip(base, check):
+            f.write(f"    {{0x{b:04X}, 0x{c:04X}}},\n")
+        f.write("};\n\n")
+
+        # The last key of the abbreviation is swallowed, so one backspace
+        # fewer than its length
+        for i, (abbrev, text) in enumerate(snippets):
+            f.write(f"static const char PROGMEM snippet_{i}[] = {c_string(chr(8) * (len(abbrev) - 1) + text)}; // {abbrev}\n")
+        f.write("\nconst char *const PROGMEM snippet_text[] = {\n")
+        for i in range(len(snippets)):
+            f.write(f"    snippet_{i},\n")
+        f.write("};\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("keymap_dir")
+    args = parser.parse_args()
+
+    snippets = parse(os.path.join(args.keymap_dir, "snippets.txt"))
+    if not snippets:
+        sys.exit("snippets.txt has no snippets")
+
+    symbols, base, check = build(snippets)
+    emit(args.keymap_dir, snippets, symbols, base, check)
+
+    text = sum(len(t) + len(a) for a, t in snippets)
+    print(f"{len(snippets)} snippets, {len(symbols)} symbols: {len(base)} nodes ({len(base) * 4} bytes) + {text} bytes of text")
+
+
+if __name__ == "__main__":
+    main()
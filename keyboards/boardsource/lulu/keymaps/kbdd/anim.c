@@ -14,11 +14,14 @@
 #include QMK_KEYBOARD_H
 #include "anim.h"
 #include "constants.h"
-#include "progmem_anim.h"
+#include "progmem_atlas.h"
 #include "progmem_horizon.h"
 #include "oled_utils.h"
 #include "oled_unified_anim.h" // Modern unified animation system
 #include "wpm_stats.h"
+#include "hot_path.h"
+#include "compact_anim.h"
+#include "anim_clock.h"
 
 // ============================================================================
 // Modern Slice Macros (using comprehensive oled_slice.h system)
@@ -47,48 +50,72 @@
 #define LAYER_REGION_WIDTH 104
 #define LAYER_REGION_HEIGHT 19
 
+// ============================================================================
+// Toggle Animation Backend
+// ============================================================================
+
+// Layer and modifier sprites are plain toggles. On AVR they run on the compact
+// 16-bit state from compact_anim.h, everywhere else on the unified controller.
+#ifdef ANIM_COMPACT_STATE
+#    define DEFINE_TOGGLE_SEQ(name, ...) static const slice_t name##_frames[] = {__VA_ARGS__}
+#    define TOGGLE_CONFIG(name, x, y) COMPACT_TOGGLE_CONFIG(name##_frames, x, y)
+#    define toggle_anim_init(anim, config, state, now) compact_anim_init(anim, config, state)
+#    define toggle_anim_trigger(anim, state, now) ((void)(now), compact_anim_trigger(anim, state))
+#    define toggle_anim_render(anim, now) ((void)(now), compact_anim_render(anim))
+typedef compact_anim_t        toggle_anim_t;
+typedef compact_anim_config_t toggle_anim_config_t;
+#else
+#    define DEFINE_TOGGLE_SEQ(name, ...) DEFINE_SLICE_SEQ(name, __VA_ARGS__)
+#    define TOGGLE_CONFIG(name, x, y) UNIFIED_TOGGLE_CONFIG(&name, x, y, BLEND_ADDITIVE)
+#    define toggle_anim_init unified_anim_init
+#    define toggle_anim_trigger unified_anim_trigger
+#    define toggle_anim_render unified_anim_render
+typedef unified_anim_t        toggle_anim_t;
+typedef unified_anim_config_t toggle_anim_config_t;
+#endif
+
 // ============================================================================
 // Animation Sequences (same data, modern organization)
 // ============================================================================
 
 // Layer animation sequences
-DEFINE_SLICE_SEQ(qwerty, SLICE48x7(qwerty_0), SLICE48x7(qwerty_1), SLICE48x7(qwerty_2), SLICE48x7(qwerty_3), );
+DEFINE_TOGGLE_SEQ(qwerty, SLICE48x7(ATLAS(qwerty_0)), SLICE48x7(ATLAS(qwerty_1)), SLICE48x7(ATLAS(qwerty_2)), SLICE48x7(ATLAS(qwerty_3)), );
 
-DEFINE_SLICE_SEQ(symbol, SLICE48x7(symbol_0), SLICE48x7(symbol_1), SLICE48x7(symbol_2), SLICE48x7(symbol_3), );
+DEFINE_TOGGLE_SEQ(symbol, SLICE48x7(ATLAS(symbol_0)), SLICE48x7(ATLAS(symbol_1)), SLICE48x7(ATLAS(symbol_2)), SLICE48x7(ATLAS(symbol_3)), );
 
-DEFINE_SLICE_SEQ(navigation, SLICE64x7(navigation_0), SLICE64x7(navigation_1), SLICE64x7(navigation_2), SLICE64x7(navigation_3), );
+DEFINE_TOGGLE_SEQ(navigation, SLICE64x7(ATLAS(navigation_0)), SLICE64x7(ATLAS(navigation_1)), SLICE64x7(ATLAS(navigation_2)), SLICE64x7(ATLAS(navigation_3)), );
 
-DEFINE_SLICE_SEQ(function, SLICE56x7(function_0), SLICE56x7(function_1), SLICE56x7(function_2), SLICE56x7(function_3), );
+DEFINE_TOGGLE_SEQ(function, SLICE56x7(ATLAS(function_0)), SLICE56x7(ATLAS(function_1)), SLICE56x7(ATLAS(function_2)), SLICE56x7(ATLAS(function_3)), );
 
-DEFINE_SLICE_SEQ(gaming, SLICE48x7(gaming_0), SLICE48x7(gaming_1), SLICE48x7(gaming_2), SLICE48x7(gaming_3), );
+DEFINE_TOGGLE_SEQ(gaming, SLICE48x7(ATLAS(gaming_0)), SLICE48x7(ATLAS(gaming_1)), SLICE48x7(ATLAS(gaming_2)), SLICE48x7(ATLAS(gaming_3)), );
 
-DEFINE_SLICE_SEQ(unicode, SLICE48x7(unicode_0), SLICE48x7(unicode_1), SLICE48x7(unicode_2), SLICE48x7(unicode_3), );
+DEFINE_TOGGLE_SEQ(unicode, SLICE48x7(ATLAS(unicode_0)), SLICE48x7(ATLAS(unicode_1)), SLICE48x7(ATLAS(unicode_2)), SLICE48x7(ATLAS(unicode_3)), );
 
 // Boot animations
-DEFINE_SLICE_SEQ(boot, SLICE128x32(boot_0), SLICE128x32(boot_1), SLICE128x32(boot_2), SLICE128x32(boot_3), SLICE128x32(boot_4), SLICE128x32(boot_5), SLICE128x32(boot_6), SLICE128x32(boot_7), SLICE128x32(boot_8), SLICE128x32(boot_9), SLICE128x32(boot_10), SLICE128x32(boot_11), SLICE128x32(boot_12), SLICE128x32(boot_13), SLICE128x32(boot_14), SLICE128x32(boot_15), );
+DEFINE_SLICE_SEQ(boot, SLICE128x32(ATLAS(boot_0)), SLICE128x32(ATLAS(boot_1)), SLICE128x32(ATLAS(boot_2)), SLICE128x32(ATLAS(boot_3)), SLICE128x32(ATLAS(boot_4)), SLICE128x32(ATLAS(boot_5)), SLICE128x32(ATLAS(boot_6)), SLICE128x32(ATLAS(boot_7)), SLICE128x32(ATLAS(boot_8)), SLICE128x32(ATLAS(boot_9)), SLICE128x32(ATLAS(boot_10)), SLICE128x32(ATLAS(boot_11)), SLICE128x32(ATLAS(boot_12)), SLICE128x32(ATLAS(boot_13)), SLICE128x32(ATLAS(boot_14)), SLICE128x32(ATLAS(boot_15)), );
 
 // Horizon
 DEFINE_SLICE_SEQ(horizon, SLICE128x32(horizon_0), SLICE128x32(horizon_1), SLICE128x32(horizon_2), SLICE128x32(horizon_3), );
 
 // Modifier animation sequences (NOW RE-ENABLED with unified system!)
-DEFINE_SLICE_SEQ(super, SLICE39x9(super_0), SLICE39x9(super_1), SLICE39x9(super_2), SLICE39x9(super_3), );
+DEFINE_TOGGLE_SEQ(super, SLICE39x9(ATLAS(super_0)), SLICE39x9(ATLAS(super_1)), SLICE39x9(ATLAS(super_2)), SLICE39x9(ATLAS(super_3)), );
 
-DEFINE_SLICE_SEQ(alt, SLICE25x9(alt_0), SLICE25x9(alt_1), SLICE25x9(alt_2), SLICE25x9(alt_3), );
+DEFINE_TOGGLE_SEQ(alt, SLICE25x9(ATLAS(alt_0)), SLICE25x9(ATLAS(alt_1)), SLICE25x9(ATLAS(alt_2)), SLICE25x9(ATLAS(alt_3)), );
 
-DEFINE_SLICE_SEQ(shift, SLICE33x9(shift_0), SLICE33x9(shift_1), SLICE33x9(shift_2), SLICE33x9(shift_3), );
+DEFINE_TOGGLE_SEQ(shift, SLICE33x9(ATLAS(shift_0)), SLICE33x9(ATLAS(shift_1)), SLICE33x9(ATLAS(shift_2)), SLICE33x9(ATLAS(shift_3)), );
 
-DEFINE_SLICE_SEQ(ctrl, SLICE33x9(ctrl_0), SLICE33x9(ctrl_1), SLICE33x9(ctrl_2), SLICE33x9(ctrl_3), );
+DEFINE_TOGGLE_SEQ(ctrl, SLICE33x9(ATLAS(ctrl_0)), SLICE33x9(ATLAS(ctrl_1)), SLICE33x9(ATLAS(ctrl_2)), SLICE33x9(ATLAS(ctrl_3)), );
 
 // ============================================================================
 // Modern Unified Animation System
 // ============================================================================
 
-static const unified_anim_config_t qwerty_config        = UNIFIED_TOGGLE_CONFIG(&qwerty, 1, 11, BLEND_ADDITIVE);
-static const unified_anim_config_t gaming_config        = UNIFIED_TOGGLE_CONFIG(&gaming, 1, 17, BLEND_ADDITIVE);
-static const unified_anim_config_t unicode_layer_config = UNIFIED_TOGGLE_CONFIG(&unicode, 1, 23, BLEND_ADDITIVE);
-static const unified_anim_config_t symbol_config        = UNIFIED_TOGGLE_CONFIG(&symbol, 57, 11, BLEND_ADDITIVE);
-static const unified_anim_config_t navigation_config    = UNIFIED_TOGGLE_CONFIG(&navigation, 41, 17, BLEND_ADDITIVE);
-static const unified_anim_config_t function_config      = UNIFIED_TOGGLE_CONFIG(&function, 49, 23, BLEND_ADDITIVE);
+static const toggle_anim_config_t qwerty_config        = TOGGLE_CONFIG(qwerty, 1, 11);
+static const toggle_anim_config_t gaming_config        = TOGGLE_CONFIG(gaming, 1, 17);
+static const toggle_anim_config_t unicode_layer_config = TOGGLE_CONFIG(unicode, 1, 23);
+static const toggle_anim_config_t symbol_config        = TOGGLE_CONFIG(symbol, 57, 11);
+static const toggle_anim_config_t navigation_config    = TOGGLE_CONFIG(navigation, 41, 17);
+static const toggle_anim_config_t function_config      = TOGGLE_CONFIG(function, 49, 23);
 
 static const unified_anim_config_t boot_config = UNIFIED_BOOTREV_CONFIG(&boot, 0, 0, true);
 
@@ -96,26 +123,26 @@ static const unified_anim_config_t boot_config = UNIFIED_BOOTREV_CONFIG(&boot, 0
 static const unified_anim_config_t horizon_config = UNIFIED_LOOP_CONFIG(&horizon, 0, 0, STEADY_LAST, true);
 
 // Modifier animations (toggle pattern - smooth on/off transitions)
-static const unified_anim_config_t super_config = UNIFIED_TOGGLE_CONFIG(&super, 0, 0, BLEND_ADDITIVE);
-static const unified_anim_config_t alt_config   = UNIFIED_TOGGLE_CONFIG(&alt, 37, 0, BLEND_ADDITIVE);
-static const unified_anim_config_t shift_config = UNIFIED_TOGGLE_CONFIG(&shift, 64, 0, BLEND_ADDITIVE);
-static const unified_anim_config_t ctrl_config  = UNIFIED_TOGGLE_CONFIG(&ctrl, 95, 0, BLEND_ADDITIVE);
+static const toggle_anim_config_t super_config = TOGGLE_CONFIG(super, 0, 0);
+static const toggle_anim_config_t alt_config   = TOGGLE_CONFIG(alt, 37, 0);
+static const toggle_anim_config_t shift_config = TOGGLE_CONFIG(shift, 64, 0);
+static const toggle_anim_config_t ctrl_config  = TOGGLE_CONFIG(ctrl, 95, 0);
 
 // Runtime instances
-static unified_anim_t qwerty_anim, gaming_anim, unicode_anim, symbol_anim, navigation_anim, function_anim;
+static toggle_anim_t qwerty_anim, gaming_anim, unicode_anim, symbol_anim, navigation_anim, function_anim;
 
 // Frame and boot animations
 static unified_anim_t boot_anim;
 static unified_anim_t horizon_anim;
 
 // Modifier animations (NOW WORKING!)
-static unified_anim_t super_anim, alt_anim, shift_anim, ctrl_anim;
+static toggle_anim_t super_anim, alt_anim, shift_anim, ctrl_anim;
 
-static unified_anim_t *const layer_anims[LAYER_COUNT] = {
+static toggle_anim_t *const layer_anims[LAYER_COUNT] = {
     [_BASE] = &qwerty_anim, [_GAME] = &gaming_anim, [_UNICODE] = &unicode_anim, [_NUM] = &symbol_anim, [_NAV] = &navigation_anim, [_FUNC] = &function_anim,
 };
 
-static const unified_anim_config_t *const layer_configs[LAYER_COUNT] = {
+static const toggle_anim_config_t *const layer_configs[LAYER_COUNT] = {
     [_BASE] = &qwerty_config, [_GAME] = &gaming_config, [_UNICODE] = &unicode_layer_config, [_NUM] = &symbol_config, [_NAV] = &navigation_config, [_FUNC] = &function_config,
 };
 
@@ -124,47 +151,82 @@ static inline bool layer_index_valid(uint8_t layer) {
 }
 
 // ============================================================================
-// Modifier State Detection (same as before)
+// Modifier State Detection
 // ============================================================================
 
-static bool is_super_active(void) {
-    uint8_t mods = get_mods() | get_oneshot_mods();
-    return (mods & MOD_MASK_GUI) != 0;
-}
+// Modifier sprites in draw order, keyed by the mod bits they follow. Triggers
+// only fire when those bits change between snapshots.
+typedef struct {
+    toggle_anim_t              *anim;
+    const toggle_anim_config_t *config;
+    uint8_t                     mask;
+} mod_sprite_t;
+
+static const mod_sprite_t mod_sprites[] = {
+    {&super_anim, &super_config, MOD_MASK_GUI},
+    {&alt_anim, &alt_config, MOD_MASK_ALT},
+    {&shift_anim, &shift_config, MOD_MASK_SHIFT},
+    {&ctrl_anim, &ctrl_config, MOD_MASK_CTRL},
+};
 
-static bool is_alt_active(void) {
-    uint8_t mods = get_mods() | get_oneshot_mods();
-    return (mods & MOD_MASK_ALT) != 0;
+static uint8_t last_mods = 0;
+
+// ============================================================================
+// Catch-up Policies
+// ============================================================================
+
+// Each widget group runs on its own animation clock. The boot sequence freezes
+// rather than skip frames, layer labels play missed frames through quickly,
+// and modifiers and the horizon loop jump to the current frame so what is
+// shown always matches the live state.
+static anim_clock_t boot_clock, layer_clock, mod_clock, horizon_clock;
+
+static uint32_t toggle_clock_advance(anim_clock_t *clock, uint32_t now) {
+    uint32_t virt = anim_clock_advance(clock, now);
+#ifdef ANIM_COMPACT_STATE
+    compact_anim_set_epoch(virt);
+#endif
+    return virt;
 }
 
-static bool is_shift_active(void) {
-    uint8_t mods = get_mods() | get_oneshot_mods();
-    return (mods & MOD_MASK_SHIFT) != 0;
+// The groups share one render loop, so a stall shows up in each of them;
+// report the group that lost the most rather than counting it several times.
+uint16_t anim_dropped_frames(void) {
+    const anim_clock_t *clocks[] = {&boot_clock, &layer_clock, &mod_clock, &horizon_clock};
+    uint16_t            dropped  = 0;
+    for (uint8_t i = 0; i < ARRAY_SIZE(clocks); i++) {
+        if (clocks[i]->dropped > dropped) {
+            dropped = clocks[i]->dropped;
+        }
+    }
+    return dropped;
 }
 
-static bool is_ctrl_active(void) {
-    uint8_t mods = get_mods() | get_oneshot_mods();
-    return (mods & MOD_MASK_CTRL) != 0;
+void anim_resync(void) {
+    anim_clock_resync(&boot_clock);
+    anim_clock_resync(&layer_clock);
+    anim_clock_resync(&mod_clock);
+    anim_clock_resync(&horizon_clock);
 }
 
 // ============================================================================
 // Static Elements
 // ============================================================================
 
-static const slice_t SLICE_colon = SLICE1x8(colon);
-static const slice_t SLICE_am    = SLICE5x8(am);
-static const slice_t SLICE_pm    = SLICE5x8(pm);
-
-static const slice_t         SLICE_digit_0     = SLICE5x8(digit_0);
-static const slice_t         SLICE_digit_1     = SLICE5x8(digit_1);
-static const slice_t         SLICE_digit_2     = SLICE5x8(digit_2);
-static const slice_t         SLICE_digit_3     = SLICE5x8(digit_3);
-static const slice_t         SLICE_digit_4     = SLICE5x8(digit_4);
-static const slice_t         SLICE_digit_5     = SLICE5x8(digit_5);
-static const slice_t         SLICE_digit_6     = SLICE5x8(digit_6);
-static const slice_t         SLICE_digit_7     = SLICE5x8(digit_7);
-static const slice_t         SLICE_digit_8     = SLICE5x8(digit_8);
-static const slice_t         SLICE_digit_9     = SLICE5x8(digit_9);
+static const slice_t SLICE_colon = SLICE1x8(ATLAS(colon));
+static const slice_t SLICE_am    = SLICE5x8(ATLAS(am));
+static const slice_t SLICE_pm    = SLICE5x8(ATLAS(pm));
+
+static const slice_t         SLICE_digit_0     = SLICE5x8(ATLAS(digit_0));
+static const slice_t         SLICE_digit_1     = SLICE5x8(ATLAS(digit_1));
+static const slice_t         SLICE_digit_2     = SLICE5x8(ATLAS(digit_2));
+static const slice_t         SLICE_digit_3     = SLICE5x8(ATLAS(digit_3));
+static const slice_t         SLICE_digit_4     = SLICE5x8(ATLAS(digit_4));
+static const slice_t         SLICE_digit_5     = SLICE5x8(ATLAS(digit_5));
+static const slice_t         SLICE_digit_6     = SLICE5x8(ATLAS(digit_6));
+static const slice_t         SLICE_digit_7     = SLICE5x8(ATLAS(digit_7));
+static const slice_t         SLICE_digit_8     = SLICE5x8(ATLAS(digit_8));
+static const slice_t         SLICE_digit_9     = SLICE5x8(ATLAS(digit_9));
 static const uint8_t PROGMEM blank_digit[]     = {0x00, 0x00, 0x00, 0x00, 0x00};
 static const slice_t         SLICE_blank_digit = SLICE5x8(blank_digit);
 
@@ -180,11 +242,15 @@ void sync_clock(uint32_t timestamp) {
     base_timer     = timer_read32();
 }
 
-void draw_clock(void) {
-    if (base_timestamp == 0) return;
+uint32_t clock_now(void) {
+    if (base_timestamp == 0) return 0;
 
-    uint32_t elapsed_ms        = timer_elapsed32(base_timer);
-    uint32_t current_timestamp = base_timestamp + (elapsed_ms / 1000);
+    return base_timestamp + (timer_elapsed32(base_timer) / 1000);
+}
+
+void draw_clock(const render_state_t *state) {
+    uint32_t current_timestamp = state->clock;
+    if (current_timestamp == 0) return;
 
     // Convert to HH:MM:SS
     uint32_t seconds = current_timestamp % 60;
@@ -222,7 +288,7 @@ void draw_clock(void) {
 #define WPM_AREA_Y 22
 #define WPM_AREA_WIDTH 17
 
-static void draw_wpm_slice_pixels(const slice_t *s, uint8_t x_px, uint8_t y_px) {
+static void HOT_PATH(draw_wpm_slice_pixels)(const slice_t *s, uint8_t x_px, uint8_t y_px) {
     if (!slice_is_valid(s)) {
         return;
     }
@@ -268,6 +334,86 @@ static void draw_wpm_digits(uint16_t raw_wpm) {
     }
 }
 
+// ============================================================================
+// WPM Bar
+// ============================================================================
+
+// The bar keeps what it last drew and only touches the columns between the
+// old and new fill length, so a WPM change dirties a few columns rather than
+// the whole region. The top two rows are a lane for the average marker; the
+// remaining rows hold the fill.
+#ifdef WPM_BAR_ENABLE
+#    ifndef WPM_BAR_MAX_WPM
+#        define WPM_BAR_MAX_WPM 150
+#    endif
+
+#    define WPM_BAR_MARKER_ROWS 2
+#    define WPM_BAR_NO_MARKER 0xFF
+
+static uint8_t wpm_bar_len    = 0;
+static uint8_t wpm_bar_marker = WPM_BAR_NO_MARKER;
+static bool    wpm_bar_valid  = false;
+
+static uint8_t wpm_bar_scale(uint16_t wpm) {
+    if (wpm > WPM_BAR_MAX_WPM) {
+        wpm = WPM_BAR_MAX_WPM;
+    }
+    return (uint8_t)((uint32_t)wpm * WPM_BAR_WIDTH / WPM_BAR_MAX_WPM);
+}
+
+static void wpm_bar_fill_columns(uint8_t from, uint8_t to, bool on) {
+    for (uint8_t x = from; x < to; x++) {
+        for (uint8_t y = WPM_BAR_MARKER_ROWS; y < WPM_BAR_HEIGHT; y++) {
+            oled_write_pixel(WPM_BAR_X + x, WPM_BAR_Y + y, on);
+        }
+    }
+}
+
+static void wpm_bar_marker_column(uint8_t x, bool on) {
+    for (uint8_t y = 0; y < WPM_BAR_MARKER_ROWS; y++) {
+        oled_write_pixel(WPM_BAR_X + x, WPM_BAR_Y + y, on);
+    }
+}
+
+// Forget what is on screen, e.g. after something cleared the region.
+void wpm_bar_invalidate(void) {
+    wpm_bar_valid = false;
+}
+
+static void draw_wpm_bar(uint16_t wpm, uint16_t average) {
+    uint8_t len    = wpm_bar_scale(wpm);
+    uint8_t marker = average ? wpm_bar_scale(average) : WPM_BAR_NO_MARKER;
+    if (marker == WPM_BAR_WIDTH) {
+        marker = WPM_BAR_WIDTH - 1;
+    }
+
+    if (!wpm_bar_valid) {
+        clear_rect(WPM_BAR_X, WPM_BAR_Y, WPM_BAR_WIDTH, WPM_BAR_HEIGHT);
+        wpm_bar_len    = 0;
+        wpm_bar_marker = WPM_BAR_NO_MARKER;
+        wpm_bar_valid  = true;
+    }
+
+    if (len > wpm_bar_len) {
+        wpm_bar_fill_columns(wpm_bar_len, len, true);
+    } else if (len < wpm_bar_len) {
+        wpm_bar_fill_columns(len, wpm_bar_len, false);
+    }
+    wpm_bar_len = len;
+
+    // Moving the marker is one column erased and one drawn
+    if (marker != wpm_bar_marker) {
+        if (wpm_bar_marker != WPM_BAR_NO_MARKER) {
+            wpm_bar_marker_column(wpm_bar_marker, false);
+        }
+        if (marker != WPM_BAR_NO_MARKER) {
+            wpm_bar_marker_column(marker, true);
+        }
+        wpm_bar_marker = marker;
+    }
+}
+#endif
+
 // ============================================================================
 // Modern Unified Animation Management
 // ============================================================================
@@ -276,6 +422,18 @@ void init_widgets(void) {
     uint32_t now = timer_read32();
     uint8_t  active_layer;
 
+#ifdef ANIM_COMPACT_STATE
+    compact_anim_set_epoch(now);
+#endif
+
+#ifdef WPM_BAR_ENABLE
+    wpm_bar_invalidate();
+#endif
+
+    anim_clock_init(&boot_clock, ANIM_CATCHUP_FREEZE, now);
+    anim_clock_init(&layer_clock, ANIM_CATCHUP_DOUBLE, now);
+    anim_clock_init(&mod_clock, ANIM_CATCHUP_SKIP, now);
+
     clear_rect(TOP_STRIP_X, TOP_STRIP_Y, TOP_STRIP_WIDTH, TOP_STRIP_HEIGHT);
     clear_rect(LAYER_REGION_X, LAYER_REGION_Y, LAYER_REGION_WIDTH, LAYER_REGION_HEIGHT);
 
@@ -285,34 +443,34 @@ void init_widgets(void) {
     }
 
     for (uint8_t layer = 0; layer < LAYER_COUNT; layer++) {
-        unified_anim_init(layer_anims[layer], layer_configs[layer], layer == active_layer ? 1 : 0, now);
+        toggle_anim_init(layer_anims[layer], layer_configs[layer], layer == active_layer ? 1 : 0, now);
     }
 
     // Initialize frame and boot animations
     unified_anim_init(&boot_anim, &boot_config, 0, now);
 
-    // Initialize modifier animations (NOW WORKING!)
-    unified_anim_init(&super_anim, &super_config, is_super_active() ? 1 : 0, now);
-    unified_anim_init(&alt_anim, &alt_config, is_alt_active() ? 1 : 0, now);
-    unified_anim_init(&shift_anim, &shift_config, is_shift_active() ? 1 : 0, now);
-    unified_anim_init(&ctrl_anim, &ctrl_config, is_ctrl_active() ? 1 : 0, now);
+    // Initialize modifier animations from the current mods
+    last_mods = get_mods() | get_oneshot_mods();
+    for (uint8_t i = 0; i < ARRAY_SIZE(mod_sprites); i++) {
+        toggle_anim_init(mod_sprites[i].anim, mod_sprites[i].config, (last_mods & mod_sprites[i].mask) ? 1 : 0, now);
+    }
 }
 
 // ============================================================================
 // Modern Layer Transition Management
 // ============================================================================
 
-void tick_widgets(void) {
+void tick_widgets(const render_state_t *state) {
     uint32_t now = timer_read32();
 
     // Resolve desired layer with bounds checking
-    uint8_t new_layer = get_highest_layer(layer_state);
+    uint8_t new_layer = state->layer;
     if (!layer_index_valid(new_layer)) {
         new_layer = _BASE;
     }
 
     // Update frame animations (background elements) - MUST render BEFORE layer animations
-    unified_anim_render(&boot_anim, now);
+    unified_anim_render(&boot_anim, anim_clock_advance(&boot_clock, now));
 
     // The layer label and modifier sprites share a top strip and overlap slightly.
     // Redraw the entire strip from a clean slate so black pixels in later sprites
@@ -323,22 +481,28 @@ void tick_widgets(void) {
     // shared region before rendering each toggle state.
     clear_rect(LAYER_REGION_X, LAYER_REGION_Y, LAYER_REGION_WIDTH, LAYER_REGION_HEIGHT);
 
+    uint32_t layer_now = toggle_clock_advance(&layer_clock, now);
     for (uint8_t layer = 0; layer < LAYER_COUNT; layer++) {
-        unified_anim_trigger(layer_anims[layer], layer == new_layer ? 1 : 0, now);
-        unified_anim_render(layer_anims[layer], now);
+        toggle_anim_trigger(layer_anims[layer], layer == new_layer ? 1 : 0, layer_now);
+        toggle_anim_render(layer_anims[layer], layer_now);
     }
 
-    // Update modifier animations with current state (NOW WORKING!)
-    unified_anim_trigger(&super_anim, is_super_active() ? 1 : 0, now);
-    unified_anim_trigger(&alt_anim, is_alt_active() ? 1 : 0, now);
-    unified_anim_trigger(&shift_anim, is_shift_active() ? 1 : 0, now);
-    unified_anim_trigger(&ctrl_anim, is_ctrl_active() ? 1 : 0, now);
+    // Trigger modifier animations on edges only; steady state is one compare.
+    uint32_t mod_now = toggle_clock_advance(&mod_clock, now);
+    uint8_t  changed = state->mods ^ last_mods;
+    if (changed) {
+        for (uint8_t i = 0; i < ARRAY_SIZE(mod_sprites); i++) {
+            if (changed & mod_sprites[i].mask) {
+                toggle_anim_trigger(mod_sprites[i].anim, (state->mods & mod_sprites[i].mask) ? 1 : 0, mod_now);
+            }
+        }
+        last_mods = state->mods;
+    }
 
     // Render modifier animations in draw order across the cleared top strip.
-    unified_anim_render(&super_anim, now);
-    unified_anim_render(&alt_anim, now);
-    unified_anim_render(&shift_anim, now);
-    unified_anim_render(&ctrl_anim, now);
+    for (uint8_t i = 0; i < ARRAY_SIZE(mod_sprites); i++) {
+        toggle_anim_render(mod_sprites[i].anim, mod_now);
+    }
 }
 
 void draw_horizon(void) {
@@ -347,6 +511,7 @@ void draw_horizon(void) {
     // Initialize Horizon animations
     static bool horizon_initialized = false;
     if (!horizon_initialized) {
+        anim_clock_init(&horizon_clock, ANIM_CATCHUP_SKIP, now);
         unified_anim_init(&horizon_anim, &horizon_config, 0, now);
         horizon_initialized = true;
     }
@@ -354,10 +519,10 @@ void draw_horizon(void) {
     oled_clear();
 
     // Render Horizon animations
-    unified_anim_render(&horizon_anim, now);
+    unified_anim_render(&horizon_anim, anim_clock_advance(&horizon_clock, now));
 }
 
-void draw_wpm_frame(void) {
+void draw_wpm_frame(const render_state_t *state) {
     // Initialize WPM animations on first call (slave screen only)
     static bool wpm_initialized = false;
     if (!wpm_initialized) {
@@ -367,7 +532,11 @@ void draw_wpm_frame(void) {
     //clear_rect(WPM_AREA_X, WPM_AREA_Y, WPM_AREA_WIDTH, WPM_DIGIT_HEIGHT);
 
     // Draw numeric WPM (right-aligned, no leading zeros)
-    draw_wpm_digits(wpm_stats_get_current());
+    draw_wpm_digits(state->wpm);
+
+#ifdef WPM_BAR_ENABLE
+    draw_wpm_bar(state->wpm, state->wpm_avg);
+#endif
 }
 
 // ============================================================================
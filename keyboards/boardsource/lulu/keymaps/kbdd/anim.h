@@ -2,18 +2,33 @@
 
 #include <stdint.h>
 #include QMK_KEYBOARD_H
-#include "progmem_anim.h"
+#include "progmem_atlas.h"
 #include "oled_utils.h"
 #include "oled_unified_anim.h"  // Modern unified animation system
 #include "oled_declarative.h"
+#include "render_state.h"
 
 // Modern unified animation system
 void init_widgets(void);
 void draw_horizon(void);
-void draw_wpm_frame(void);
-void tick_widgets(void);
+void draw_wpm_frame(const render_state_t *state);
+#ifdef WPM_BAR_ENABLE
+// The bar only redraws columns that changed; call after anything else
+// touched its region so the next frame redraws it whole.
+void wpm_bar_invalidate(void);
+#endif
+void tick_widgets(const render_state_t *state);
 void sync_clock(uint32_t timestamp);
-void draw_clock(void);
+uint32_t clock_now(void);
+void draw_clock(const render_state_t *state);
+
+// Frames that fell due while the render loop was starved, for the widget
+// group that lost the most
+uint16_t anim_dropped_frames(void);
+
+// Call while the display is off or rendering is paused; the widgets pick up
+// from the current frame afterwards instead of counting the gap as dropped.
+void anim_resync(void);
 
 // Enhanced features
 bool is_boot_animation_complete(void);
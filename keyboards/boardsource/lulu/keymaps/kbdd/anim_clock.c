@@ -0,0 +1,65 @@
+/**
+ * @file anim_clock.c
+ * @brief Catch-up policies and dropped-frame accounting for animations
+ */
+
+#include QMK_KEYBOARD_H
+#include "anim_clock.h"
+#include "settings.h"
+
+void anim_clock_init(anim_clock_t *clock, anim_catchup_t policy, uint32_t now) {
+    clock->virt    = now;
+    clock->last    = now;
+    clock->dropped = 0;
+    clock->policy  = policy;
+    clock->resync  = false;
+}
+
+void anim_clock_resync(anim_clock_t *clock) {
+    clock->resync = true;
+}
+
+static void count_dropped(anim_clock_t *clock, uint32_t missed) {
+    clock->dropped = (missed >= (uint32_t)(UINT16_MAX - clock->dropped)) ? UINT16_MAX : clock->dropped + missed;
+}
+
+uint32_t anim_clock_advance(anim_clock_t *clock, uint32_t now) {
+    uint32_t gap      = TIMER_DIFF_32(now, clock->last);
+    uint16_t frame_ms = settings.anim_frame_ms;
+    clock->last       = now;
+
+    if (clock->resync) {
+        clock->resync = false;
+        if (clock->policy != ANIM_CATCHUP_FREEZE) {
+            clock->virt = now;
+        }
+        return clock->virt;
+    }
+
+    uint32_t step = gap < frame_ms ? gap : frame_ms;
+    uint32_t lag  = TIMER_DIFF_32(now, clock->virt);
+
+    // One frame is drawn now; frame boundaries jumped over before it are
+    // dropped. FREEZE never jumps, and DOUBLE only once it gives up catching up.
+    switch (clock->policy) {
+        case ANIM_CATCHUP_SKIP:
+            if (gap >= 2 * frame_ms) {
+                count_dropped(clock, gap / frame_ms - 1);
+            }
+            clock->virt = now;
+            break;
+        case ANIM_CATCHUP_DOUBLE:
+            if (lag > ANIM_CATCHUP_MAX_MS) {
+                count_dropped(clock, lag / frame_ms - 1);
+                clock->virt = now;
+            } else {
+                clock->virt += (2 * step < lag) ? 2 * step : lag;
+            }
+            break;
+        case ANIM_CATCHUP_FREEZE:
+            clock->virt += step;
+            break;
+    }
+
+    return clock->virt;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Animation time for a group of widgets. When oled_task_user() is starved
+// (blocking macros, heavy split traffic) the gap between renders grows past a
+// frame; the policy decides what the animations see afterwards.
+typedef enum {
+    ANIM_CATCHUP_SKIP,   // jump straight to the current frame
+    ANIM_CATCHUP_DOUBLE, // play the missed frames at up to twice the rate
+    ANIM_CATCHUP_FREEZE, // pause while starved and resume where it stopped
+} anim_catchup_t;
+
+typedef struct {
+    uint32_t virt;    // time handed to trigger/render
+    uint32_t last;    // real time of the previous render
+    uint16_t dropped; // frames that fell due but were never drawn, saturating
+    uint8_t  policy;
+    bool     resync;  // next advance restarts from now, see anim_clock_resync()
+} anim_clock_t;
+
+// Longest backlog ANIM_CATCHUP_DOUBLE will play through; anything older snaps
+// to the current frame and counts as dropped.
+#ifndef ANIM_CATCHUP_MAX_MS
+#    define ANIM_CATCHUP_MAX_MS 500
+#endif
+
+void     anim_clock_init(anim_clock_t *clock, anim_catchup_t policy, uint32_t now);
+uint32_t anim_clock_advance(anim_clock_t *clock, uint32_t now);
+
+// Rendering stopped on purpose (display off, paused); the gap before the next
+// advance is neither counted as dropped nor replayed.
+void anim_clock_resync(anim_clock_t *clock);
@@ -0,0 +1,121 @@
+/**
+ * @file boot_timing.c
+ * @brief Reset-to-usable timing milestones, readable over raw HID
+ *
+ * The record lives in RAM that the C runtime does not clear, so a soft reset
+ * (bootloader jump, watchdog, QK_REBOOT) keeps the previous run around for the
+ * host to compare against.
+ */
+
+#include <string.h>
+#include "boot_timing.h"
+#include "hot_path.h"
+
+#ifdef SPLIT_KEYBOARD
+#    include "transport.h"
+#endif
+#include "usb_device_state.h"
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#endif
+
+#if defined(__AVR__)
+#    define BOOT_TIMING_NOINIT __attribute__((section(".noinit")))
+#elif defined(PROTOCOL_CHIBIOS)
+// .ram0 is NOLOAD in the ChibiOS linker scripts and is not zeroed by crt0
+#    define BOOT_TIMING_NOINIT __attribute__((section(".ram0.boot_timing")))
+#else
+#    define BOOT_TIMING_NOINIT
+#endif
+
+#define BOOT_TIMING_MAGIC 0x4B424454 // "KBDT"
+
+typedef struct {
+    uint32_t stamps[BOOT_STAMP_COUNT];
+    uint8_t  recorded; // bit per boot_stamp_t, since a stamp of 0 is valid
+} boot_run_t;
+
+typedef struct {
+    uint32_t   magic;
+    uint8_t    boot_count;
+    boot_run_t current;
+    boot_run_t previous;
+} boot_timing_t;
+
+_Static_assert(BOOT_STAMP_COUNT <= 8, "recorded mask is a single byte");
+
+static boot_timing_t BOOT_TIMING_NOINIT boot_timing;
+
+void boot_timing_init(void) {
+    if (boot_timing.magic == BOOT_TIMING_MAGIC) {
+        boot_timing.previous = boot_timing.current;
+        boot_timing.boot_count++;
+    } else {
+        memset(&boot_timing, 0, sizeof(boot_timing));
+        boot_timing.magic = BOOT_TIMING_MAGIC;
+    }
+
+    memset(&boot_timing.current, 0, sizeof(boot_timing.current));
+
+    // keyboard_pre_init_user() runs before timer_init(), so the timer cannot
+    // be read here yet. Every other stamp counts from timer_init(), which
+    // follows straight after, so that is recorded as the reset point.
+    boot_timing.current.stamps[BOOT_STAMP_RESET] = 0;
+    boot_timing.current.recorded |= 1u << BOOT_STAMP_RESET;
+}
+
+void HOT_PATH(boot_timing_mark)(boot_stamp_t stamp) {
+    uint8_t bit = 1u << stamp;
+    if (boot_timing.current.recorded & bit) {
+        return;
+    }
+
+    boot_timing.current.stamps[stamp] = timer_read32();
+    boot_timing.current.recorded |= bit;
+}
+
+void boot_timing_wake(void) {
+    // Re-arm the milestones that repeat on every wake so the next read shows
+    // wake-to-usable rather than cold boot numbers.
+    boot_timing.current.recorded &= (uint8_t)~((1u << BOOT_STAMP_USB_CONFIGURED) | (1u << BOOT_STAMP_FIRST_SCAN) | (1u << BOOT_STAMP_WAKE));
+    boot_timing_mark(BOOT_STAMP_WAKE);
+}
+
+void boot_timing_task(void) {
+#ifdef SPLIT_KEYBOARD
+    if (is_transport_connected()) {
+        boot_timing_mark(BOOT_STAMP_SPLIT_CONNECTED);
+    }
+#endif
+}
+
+void notify_usb_device_state_change_user(struct usb_device_state usb_device_state) {
+    if (usb_device_state.configure_state == USB_DEVICE_STATE_CONFIGURED) {
+        boot_timing_mark(BOOT_STAMP_USB_CONFIGURED);
+    }
+}
+
+#ifdef RAW_ENABLE
+// Request:  [0] = 'B', [1] = 0 for the current run, 1 for the previous run
+// Response: [0] = 'B', [1] = run, [2] = recorded mask, [3] = boot count,
+//           [4..] = big-endian uint32_t per boot_stamp_t
+void boot_timing_raw_hid(uint8_t *data, uint8_t length) {
+    const boot_run_t *run = data[1] ? &boot_timing.previous : &boot_timing.current;
+
+    memset(&data[2], 0, length - 2);
+    data[2] = run->recorded;
+    data[3] = boot_timing.boot_count;
+
+    for (uint8_t i = 0; i < BOOT_STAMP_COUNT && (4 + (i + 1) * 4) <= length; i++) {
+        uint32_t stamp = run->stamps[i];
+        uint8_t *out   = &data[4 + i * 4];
+
+        out[0] = (uint8_t)(stamp >> 24);
+        out[1] = (uint8_t)(stamp >> 16);
+        out[2] = (uint8_t)(stamp >> 8);
+        out[3] = (uint8_t)stamp;
+    }
+
+    raw_hid_send(data, length);
+}
+#endif
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+#include QMK_KEYBOARD_H
+
+// Milestones recorded between reset and a usable keyboard. Values are
+// timer_read32() timestamps (ms since timer init, which is the reset stamp)
+// and are kept in a noinit block, so the previous run can still be read back
+// after a soft reset.
+typedef enum {
+    BOOT_STAMP_RESET,           // timer_init(), always 0
+    BOOT_STAMP_POST_INIT,       // keyboard_post_init_user()
+    BOOT_STAMP_CLOCK_RPC,       // transaction_register_rpc(CLOCK_SYNC, ...)
+    BOOT_STAMP_SPLIT_CONNECTED, // split handshake completed
+    BOOT_STAMP_USB_CONFIGURED,  // host configured the device
+    BOOT_STAMP_FIRST_SCAN,      // first matrix_scan_user()
+    BOOT_STAMP_WAKE,            // suspend_wakeup_init_user()
+    BOOT_STAMP_COUNT,
+} boot_stamp_t;
+
+#define BOOT_TIMING_HID_COMMAND 'B'
+
+void boot_timing_init(void);
+void boot_timing_mark(boot_stamp_t stamp);
+void boot_timing_wake(void);
+void boot_timing_task(void);
+void boot_timing_raw_hid(uint8_t *data, uint8_t length);
@@ -0,0 +1,75 @@
+/**
+ * @file compact_anim.c
+ * @brief Toggle animations on a shared 16-bit epoch
+ */
+
+#include "compact_anim.h"
+#include "settings.h"
+
+static uint16_t epoch    = 0;
+static uint32_t epoch_at = 0; // the now that epoch was last set from
+
+// Groups on different catch-up policies pass times a little apart, so the
+// epoch steps back as well as forward; only long gaps are clamped.
+void compact_anim_set_epoch(uint32_t now) {
+    int32_t step = (int32_t)(now - epoch_at);
+    epoch_at     = now;
+
+    if (step > COMPACT_ANIM_MAX_STEP_MS) {
+        step = COMPACT_ANIM_MAX_STEP_MS;
+    } else if (step < -COMPACT_ANIM_MAX_STEP_MS) {
+        step = -COMPACT_ANIM_MAX_STEP_MS;
+    }
+    epoch += (uint16_t)step;
+}
+
+static uint8_t rest_frame(const compact_anim_t *anim) {
+    return anim->target ? anim->config->count - 1 : 0;
+}
+
+void compact_anim_init(compact_anim_t *anim, const compact_anim_config_t *config, uint8_t state) {
+    anim->config = config;
+    anim->target = state ? 1 : 0;
+    anim->frame  = rest_frame(anim);
+    anim->moving = 0;
+    anim->start  = epoch;
+}
+
+void compact_anim_trigger(compact_anim_t *anim, uint8_t state) {
+    uint8_t target = state ? 1 : 0;
+    if (anim->target == target) {
+        return;
+    }
+
+    // Reversing mid-animation plays back from the current frame
+    anim->target = target;
+    if (!anim->moving) {
+        anim->moving = 1;
+        anim->start  = epoch;
+    }
+}
+
+static void compact_anim_step(compact_anim_t *anim) {
+    if (!anim->moving) {
+        return;
+    }
+
+    uint16_t elapsed  = epoch - anim->start;
+    uint16_t frame_ms = settings.anim_frame_ms;
+    uint8_t  rest     = rest_frame(anim);
+
+    while (elapsed >= frame_ms && anim->frame != rest) {
+        anim->frame += anim->target ? 1 : -1;
+        anim->start += frame_ms;
+        elapsed -= frame_ms;
+    }
+
+    if (anim->frame == rest) {
+        anim->moving = 0;
+    }
+}
+
+void compact_anim_render(compact_anim_t *anim) {
+    compact_anim_step(anim);
+    draw_slice_px_or(&anim->config->frames[anim->frame], anim->config->x, anim->config->y);
+}
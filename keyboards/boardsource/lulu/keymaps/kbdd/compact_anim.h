@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+#include QMK_KEYBOARD_H
+#include "oled_utils.h"
+
+// Toggle animation with 16-bit wrapping time and bitfield state, for AVR where
+// 32-bit timestamps cost RAM and multi-byte arithmetic. Frame 0 is the resting
+// "off" frame and the last frame the resting "on" frame; triggering plays
+// towards the other end one frame per settings.anim_frame_ms and draws additively.
+//
+// All animations share one 16-bit epoch, advanced once per tick with
+// compact_anim_set_epoch(now). Elapsed time only matters while an animation
+// is moving, at most 15 frames of 1000 ms, so the epoch never steps more than
+// COMPACT_ANIM_MAX_STEP_MS at once: a gap of any length, including one within
+// a frame of a multiple of 65536 ms, still reads as long enough to finish.
+#define COMPACT_ANIM_MAX_STEP_MS 0x4000
+
+typedef struct {
+    const slice_t *frames;
+    uint8_t        count; // at most 16
+    uint8_t        x;
+    uint8_t        y;
+} compact_anim_config_t;
+
+#define COMPACT_TOGGLE_CONFIG(frame_array, x_px, y_px) \
+    { .frames = (frame_array), .count = ARRAY_SIZE(frame_array), .x = (x_px), .y = (y_px) }
+
+typedef struct {
+    const compact_anim_config_t *config;
+    uint16_t                     start; // epoch of the current frame
+    uint8_t                      frame : 4;
+    uint8_t                      target : 1;
+    uint8_t                      moving : 1;
+} compact_anim_t;
+
+void compact_anim_set_epoch(uint32_t now);
+void compact_anim_init(compact_anim_t *anim, const compact_anim_config_t *config, uint8_t state);
+void compact_anim_trigger(compact_anim_t *anim, uint8_t state);
+void compact_anim_render(compact_anim_t *anim);
@@ -12,12 +12,22 @@
 #    define OLED_UPDATE_PROCESS_LIMIT 16
 #endif
 
-#ifdef SPLIT_KEYBOARD
-#    define SPLIT_LAYER_STATE_ENABLE
-#    define SPLIT_WPM_ENABLE
-#    define SPLIT_ACTIVITY_ENABLE
-#    define SPLIT_MODS_ENABLE
-#endif
+// What each widget and RGB feature reads, by half: X(half, consumer, reads).
+// The master reads its own state; split_sync.h syncs only what the slave
+// rows need, so a new consumer is one row here.
+#define SPLIT_SYNC_READERS(X)                                     \
+    X(MASTER, STATUS_WIDGET, SYNC_LAYER | SYNC_MODS)              \
+    X(MASTER, WPM_WIDGET, SYNC_WPM)                               \
+    X(SLAVE, HORIZON_WIDGET, 0)                                   \
+    X(SLAVE, CLOCK_WIDGET, 0) /* CLOCK_SYNC RPC */                \
+    X(SLAVE, OLED_TIMEOUT, SYNC_ACTIVITY)                         \
+    X(SLAVE, INDICATORS, SYNC_LAYER)                              \
+    X(SLAVE, ONESHOT_INDICATOR, SYNC_MODS) /* LED 47 */           \
+    X(SLAVE, LUMINO, 0) /* RGB matrix V */                        \
+    X(SLAVE, GAME_PROFILE, SYNC_LAYER)                            \
+    X(SLAVE, ENCODER_FEEDBACK, SYNC_LAYER)
+
+#include "split_sync.h"
 
 #ifdef CAPS_WORD_ENABLE
 #    define CAPS_WORD_INVERT_ON_SHIFT
@@ -48,11 +58,29 @@
 
 #define DYNAMIC_KEYMAP_LAYER_COUNT 7
 
+// SRAM keymap mirror (RP2040 only), one bit per reachable layer
+#ifdef MCU_RP
+#    define KEYMAP_CACHE_ENABLE
+#endif
+#define KEYMAP_CACHE_LAYER_MASK 0x3F
+
+// OLED framebuffer capture over raw HID (fb_capture.h), for the RAM it needs
+#ifdef MCU_RP
+#    define FB_CAPTURE_ENABLE
+#endif
+
 // ANIM
 #define ANIM_FRAME_MS 80
 
+// 16-bit toggle animation state on the 8-bit target
+#ifdef __AVR__
+#    define ANIM_COMPACT_STATE
+#endif
+
 #define WIDGET_WATCHDOG_TIMEOUT_MS 1000
 #define WIDGET_WATCHDOG_GRACE_MS 500
+#define WIDGET_RENDER_BUDGET_US 1000
+#define WIDGET_SCREEN_RENDER_BUDGET_US 5000
 //
 
 // WPM STATS
@@ -61,13 +89,20 @@
 #undef WPM_BAR_WIDTH
 #undef WPM_BAR_HEIGHT
 
-#define WPM_BAR_X 0
-#define WPM_BAR_Y 13
-#define WPM_BAR_WIDTH 78
-#define WPM_BAR_HEIGHT 11
+// Incremental bar drawn by the keymap in the hatched track of the master's
+// WPM box, between the label and the digits. Only the bar and hiding the
+// WPM widget clear this region; the boot frame is drawn additively, so its
+// hatch shows through as the empty part of the bar.
+#define WPM_BAR_X 108
+#define WPM_BAR_Y 17
+#define WPM_BAR_WIDTH 19
+#define WPM_BAR_HEIGHT 5
+
+#define WPM_BAR_ENABLE
+#define WPM_BAR_MAX_WPM 150
 //
 
-// LUMINO
+// LUMINO (indicator_fade.h)
 #define LUMINO_HIGH_BRIGHTNESS 0.8
 #define LUMINO_LOW_BRIGHTNESS 0.4
 
@@ -78,12 +113,22 @@
 #define LUMINO_BOOT_COLOR RGB_RED
 //
 
-// ENCODER LEDMAP
+// SPLIT RPC
 #undef SPLIT_TRANSACTION_IDS_USER
-#define SPLIT_TRANSACTION_IDS_USER ENCODER_LEDMAP_SYNC, CLOCK_SYNC
+#define SPLIT_TRANSACTION_IDS_USER CLOCK_SYNC, SETTINGS_SYNC, FB_CAPTURE_SYNC, WIDGET_WATCHDOG_SYNC
 //
 
 // UNICODE
 #define UNICODE_SELECTED_MODES UNICODE_MODE_WINCOMPOSE
+// Batch code points to lulu.py daemon when it is running
+#define UNICODE_HOST_ENABLE
 #define TAPPING_TOGGLE 2
 //
+
+// SETTINGS
+// Defaults for the host-tunable settings (settings.h) come from ANIM_FRAME_MS,
+// OLED_TIMEOUT and the LUMINO_* timeouts above. TAPPING_TOGGLE is still
+// compile-time.
+#define SLUG_LOCK_TIMEOUT 3000
+#define EECONFIG_USER_DATA_SIZE 16
+//
@@ -5,7 +5,7 @@
 enum layers { _BASE, _GAME, _UNICODE, _NUM, _NAV, _FUNC };
 enum { LAYER_COUNT = _FUNC + 1 };
 enum { TD_CMD, TD_BLUETOOTH_MUTE };
-enum custom_keycodes { CUS_TSK = SAFE_RANGE, CUS_SNT, CUS_SLK, CUS_CODE };
+enum custom_keycodes { CUS_TSK = SAFE_RANGE, CUS_SNT, CUS_SLK, CUS_CODE, CUS_MREC, CUS_MPLY, CUS_MPLT, LUMINO };
 
 // simple layers, no tri-layer
 #define NUM MO(_NUM)
@@ -0,0 +1,94 @@
+/**
+ * @file encoder_feedback.c
+ * @brief Encoder LED feedback, computed on the half that turns the encoder
+ *
+ * The encoder and its LED sit on the same half, so that half already knows
+ * every detent and nothing has to cross the split. As master it sees them as
+ * encoder events in process_record_user(); as slave it reads its own encoder
+ * event queue, without draining it, the way the split transport does before
+ * handing the events to the master. The layer comes from the synced layer
+ * state. The LED keeps the colour of the last direction turned.
+ */
+
+#include "encoder_feedback.h"
+#include "hot_path.h"
+#include "indicator_fade.h"
+
+typedef union {
+    uint8_t raw;
+    struct {
+        uint8_t clockwise : 1;
+        uint8_t index : 2;
+        uint8_t valid : 1;
+    };
+} encoder_detent_t;
+
+_Static_assert(sizeof(encoder_detent_t) == 1, "encoder_detent_t must stay one byte");
+_Static_assert(NUM_ENCODERS <= 4, "encoder_detent_t holds four encoders");
+
+static encoder_detent_t shown;
+
+static bool encoder_led_is_local(uint8_t led) {
+#if defined(SPLIT_KEYBOARD) && defined(RGB_MATRIX_SPLIT)
+    return (led < k_rgb_matrix_split[0]) == is_keyboard_left();
+#else
+    return true;
+#endif
+}
+
+static void encoder_feedback_show(uint8_t index, bool clockwise) {
+    if (index < NUM_ENCODERS && encoder_led_is_local(encoder_leds[index])) {
+        shown.clockwise = clockwise;
+        shown.index     = index;
+        shown.valid     = 1;
+    }
+}
+
+void HOT_PATH(encoder_feedback_note)(keyrecord_t *record) {
+    if (IS_ENCODEREVENT(record->event) && record->event.pressed) {
+        encoder_feedback_show(record->event.key.col, record->event.key.row == KEYLOC_ENCODER_CW);
+    }
+}
+
+void encoder_feedback_task(void) {
+#if defined(SPLIT_KEYBOARD) && defined(MAX_QUEUED_ENCODER_EVENTS)
+    static uint8_t seen_head;
+
+    if (is_keyboard_master()) {
+        return;
+    }
+
+    // Everything queued since the last pass; the master drains from the
+    // tail, which never moves the head, so head alone marks what is new.
+    encoder_events_t events;
+    encoder_retrieve_events(&events);
+    while (seen_head != events.head) {
+        const encoder_event_t *event = &events.queue[seen_head];
+        encoder_feedback_show(event->index, event->clockwise);
+        seen_head = (seen_head + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    }
+#endif
+}
+
+void encoder_feedback_render(void) {
+    if (!shown.valid) {
+        return;
+    }
+
+    uint8_t layer = get_highest_layer(layer_state);
+    if (layer >= encoder_ledmap_layers) {
+        return;
+    }
+
+    color_t       color;
+    const color_t trns = TRNS_COLOR;
+    memcpy_P(&color, &encoder_ledmap[layer][shown.index][shown.clockwise], sizeof(color));
+    if (memcmp(&color, &trns, sizeof(color)) == 0) {
+        return;
+    }
+
+    rgb_t rgb;
+    get_rgb(color, &rgb);
+    indicator_fade_apply(&rgb);
+    rgb_matrix_set_color(encoder_leds[shown.index], rgb.r, rgb.g, rgb.b);
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include QMK_KEYBOARD_H
+#include "elpekenin/colors.h"
+
+// Encoder LED feedback, computed and drawn on the half that owns the LED,
+// which is also the half the encoder is on. Nothing crosses the split.
+
+extern const uint8_t encoder_leds[NUM_ENCODERS];
+extern const color_t PROGMEM encoder_ledmap[][NUM_ENCODERS][NUM_DIRECTIONS];
+extern const uint8_t encoder_ledmap_layers;
+
+// Master: note a detent from process_record_user()
+void encoder_feedback_note(keyrecord_t *record);
+
+// Slave: pick up detents from the local encoder queue
+void encoder_feedback_task(void);
+
+// Either half: paint the LED if it is local and feedback is active
+void encoder_feedback_render(void);
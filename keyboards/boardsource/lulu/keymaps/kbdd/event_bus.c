@@ -0,0 +1,72 @@
+/**
+ * @file event_bus.c
+ * @brief Lock-free broadcast ring for key, layer and modifier events
+ *
+ * One producer (the key path) and any number of readers, each with its own
+ * cursor. The producer never waits for readers; a reader copies a slot and
+ * then re-checks the head to detect that it was lapped while copying, so no
+ * locks or read-modify-write atomics are needed. Head and tails are 32-bit
+ * sequence numbers, the slot being the low bits, so a reader sees how far
+ * behind it is however many laps that is. Their loads and stores are single
+ * instructions on the RP2040; on AVR they are not, so there the bus is only
+ * safe between main-loop producers and readers, which is all this keymap has.
+ */
+
+#include QMK_KEYBOARD_H
+#include "event_bus.h"
+#include "hot_path.h"
+
+static event_t ring[EVENT_BUS_SIZE];
+static uint32_t head = 0; // written by the producer only
+
+void HOT_PATH(event_post)(event_type_t type, uint8_t value, uint16_t keycode) {
+    uint32_t h = __atomic_load_n(&head, __ATOMIC_RELAXED);
+
+    // Pairs with the fence in event_read(): a reader that sees any of this
+    // slot's new contents also sees the head bump from the previous post,
+    // which is what tells it the slot was being reused.
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    ring[h & (EVENT_BUS_SIZE - 1)] = (event_t){
+        .type    = type,
+        .value   = value,
+        .keycode = keycode,
+        .time    = timer_read(),
+    };
+    __atomic_store_n(&head, h + 1, __ATOMIC_RELEASE);
+}
+
+void event_reader_init(event_reader_t *reader) {
+    reader->tail    = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+    reader->dropped = 0;
+}
+
+bool event_read(event_reader_t *reader, event_t *event) {
+    for (;;) {
+        uint32_t h = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+        if (reader->tail == h) {
+            return false;
+        }
+
+        // The oldest slot is the next one the producer writes, so keep at
+        // most EVENT_BUS_SIZE - 1 events of backlog.
+        if (h - reader->tail >= EVENT_BUS_SIZE) {
+            uint32_t skip   = h - reader->tail - (EVENT_BUS_SIZE - 1);
+            reader->dropped = skip > (uint32_t)(UINT8_MAX - reader->dropped) ? UINT8_MAX : reader->dropped + skip;
+            reader->tail += skip;
+        }
+
+        *event = ring[reader->tail & (EVENT_BUS_SIZE - 1)];
+
+        // The producer may have lapped us while we copied; if the slot was
+        // reused, throw the copy away and resynchronise. The fence keeps the
+        // copy from being reordered past this load of head.
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        h = __atomic_load_n(&head, __ATOMIC_RELAXED);
+        if (h - reader->tail >= EVENT_BUS_SIZE) {
+            continue;
+        }
+
+        reader->tail++;
+        return true;
+    }
+}
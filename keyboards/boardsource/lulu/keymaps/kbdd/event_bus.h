@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef enum {
+    EVENT_KEY,          // keycode, value = pressed
+    EVENT_LAYER,        // value = highest active layer
+    EVENT_ONESHOT_MODS, // value = oneshot mods
+    EVENT_SLUG_LOCK,    // value = active
+} event_type_t;
+
+typedef struct {
+    uint8_t  type;
+    uint8_t  value;
+    uint16_t keycode;
+    uint16_t time;
+} event_t;
+
+// Each consumer owns a reader and drains at its own rate. A reader that falls
+// EVENT_BUS_SIZE events behind skips ahead and counts the loss; dropped
+// saturates at 255 until the consumer clears it.
+typedef struct {
+    uint32_t tail;
+    uint8_t  dropped;
+} event_reader_t;
+
+#ifndef EVENT_BUS_SIZE
+#    define EVENT_BUS_SIZE 16
+#endif
+
+_Static_assert((EVENT_BUS_SIZE & (EVENT_BUS_SIZE - 1)) == 0, "EVENT_BUS_SIZE must be a power of two");
+
+void event_post(event_type_t type, uint8_t value, uint16_t keycode);
+void event_reader_init(event_reader_t *reader);
+bool event_read(event_reader_t *reader, event_t *event);
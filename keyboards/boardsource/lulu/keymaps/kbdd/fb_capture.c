@@ -0,0 +1,220 @@
+/**
+ * @file fb_capture.c
+ * @brief Delta-encoded OLED framebuffer capture over raw HID
+ *
+ * Request: 'F', half (0 master, 1 slave, 0xFF stop). Sent again at least
+ * every FB_CAPTURE_TIMEOUT_MS to keep the capture going; a request for the
+ * other half restarts with a keyframe.
+ *
+ * Reports: 'F', seq, frame, flags, time (u16 ms), then runs of offset
+ * (u16), length and that many buffer bytes. Big-endian. seq counts every
+ * report from 0 at the start, so the host can tell when one was lost and ask
+ * for a restart. The first frame after a start is a keyframe covering the
+ * whole buffer; later frames carry only changed runs. The last report of a
+ * frame has FB_END set, with or without runs, and the host draws the frame on
+ * it.
+ *
+ * The master's buffer is copied whole when a frame starts, so a frame never
+ * mixes two renders. The slave's is read a window at a time over the split.
+ */
+
+#include "fb_capture.h"
+#if defined(SPLIT_KEYBOARD) && defined(FB_CAPTURE_ENABLE)
+#    include "transactions.h"
+#endif
+
+#define FB_KEYFRAME 0x01
+#define FB_SLAVE 0x40
+#define FB_END 0x80
+
+#define FB_STOP 0xFF
+
+#define FB_REPORT_SIZE 32
+#define FB_HEADER_SIZE 6
+#define FB_RUN_HEADER_SIZE 3
+
+// Buffer bytes read per step
+#define FB_WINDOW 32
+
+// Unchanged bytes bridged rather than starting a new run, which costs a
+// run header
+#define FB_RUN_GAP FB_RUN_HEADER_SIZE
+
+#if defined(FB_CAPTURE_ENABLE) && defined(RAW_ENABLE) && defined(OLED_ENABLE)
+#    include "raw_hid.h"
+
+_Static_assert(OLED_MATRIX_SIZE % FB_WINDOW == 0, "OLED buffer must be a whole number of windows");
+#    if defined(SPLIT_KEYBOARD) && defined(RPC_S2M_BUFFER_SIZE)
+_Static_assert(FB_WINDOW <= RPC_S2M_BUFFER_SIZE, "FB_CAPTURE_SYNC window larger than the split RPC buffer");
+#    endif
+
+static uint8_t  shadow[OLED_MATRIX_SIZE];
+static uint8_t  master_frame[OLED_MATRIX_SIZE];
+static bool     active = false;
+static bool     slave;
+static bool     keyframe;
+static uint8_t  seq;
+static uint8_t  frame;
+static uint16_t cursor;
+static uint32_t frame_start;
+static uint32_t last_step;
+static uint32_t renewed;
+
+static uint8_t report[FB_REPORT_SIZE];
+static uint8_t report_fill;
+
+static void report_send(bool end) {
+    uint16_t now = timer_read();
+
+    report[0] = FB_CAPTURE_HID_COMMAND;
+    report[1] = seq++;
+    report[2] = frame;
+    report[3] = (keyframe ? FB_KEYFRAME : 0) | (slave ? FB_SLAVE : 0) | (end ? FB_END : 0);
+    report[4] = (uint8_t)(now >> 8);
+    report[5] = (uint8_t)now;
+    raw_hid_send(report, sizeof(report));
+
+    memset(report, 0, sizeof(report));
+    report_fill = FB_HEADER_SIZE;
+}
+
+static void report_run(uint16_t offset, const uint8_t *data, uint8_t length) {
+    while (length) {
+        if (report_fill + FB_RUN_HEADER_SIZE >= FB_REPORT_SIZE) {
+            report_send(false);
+        }
+
+        uint8_t n = MIN(length, FB_REPORT_SIZE - report_fill - FB_RUN_HEADER_SIZE);
+
+        report[report_fill++] = (uint8_t)(offset >> 8);
+        report[report_fill++] = (uint8_t)offset;
+        report[report_fill++] = n;
+        memcpy(&report[report_fill], data, n);
+        report_fill += n;
+
+        offset += n;
+        data += n;
+        length -= n;
+    }
+}
+
+#    ifdef SPLIT_KEYBOARD
+static void fb_capture_slave_handler(uint8_t in_buflen, const void *in_data, uint8_t out_buflen, void *out_data) {
+    if (in_buflen < sizeof(uint16_t)) {
+        return;
+    }
+
+    uint16_t             offset = *(const uint16_t *)in_data;
+    oled_buffer_reader_t reader = oled_read_raw(offset);
+    memcpy(out_data, reader.current_element, MIN(out_buflen, reader.remaining_element_count));
+}
+#    endif
+
+static bool read_window(uint8_t *window) {
+    if (!slave) {
+        memcpy(window, &master_frame[cursor], FB_WINDOW);
+        return true;
+    }
+#    ifdef SPLIT_KEYBOARD
+    return transaction_rpc_exec(FB_CAPTURE_SYNC, sizeof(cursor), &cursor, FB_WINDOW, window);
+#    else
+    return false;
+#    endif
+}
+
+// Runs of changed bytes in the window, merged across short unchanged gaps
+static void diff_window(const uint8_t *window) {
+    uint8_t i = 0;
+
+    while (i < FB_WINDOW) {
+        if (!keyframe && window[i] == shadow[cursor + i]) {
+            i++;
+            continue;
+        }
+
+        uint8_t start = i;
+        uint8_t end   = i + 1; // one past the last changed byte
+        for (uint8_t j = end; j < FB_WINDOW && j - end <= FB_RUN_GAP; j++) {
+            if (keyframe || window[j] != shadow[cursor + j]) {
+                end = j + 1;
+            }
+        }
+
+        report_run(cursor + start, &window[start], end - start);
+        memcpy(&shadow[cursor + start], &window[start], end - start);
+        i = end;
+    }
+}
+
+static void fb_capture_start(bool from_slave) {
+    slave    = from_slave;
+    active   = true;
+    keyframe = true;
+    seq      = 0;
+    frame    = 0;
+    cursor   = 0;
+    memset(report, 0, sizeof(report));
+    report_fill = FB_HEADER_SIZE;
+    frame_start = timer_read32() - FB_CAPTURE_FRAME_MS;
+}
+
+void fb_capture_init(void) {
+#    ifdef SPLIT_KEYBOARD
+    transaction_register_rpc(FB_CAPTURE_SYNC, fb_capture_slave_handler);
+#    endif
+}
+
+void fb_capture_task(void) {
+    if (!active) {
+        return;
+    }
+    if (timer_elapsed32(renewed) >= FB_CAPTURE_TIMEOUT_MS) {
+        active = false; // host tool gone
+        return;
+    }
+    if (timer_elapsed32(last_step) < FB_CAPTURE_STEP_MS) {
+        return;
+    }
+    if (cursor == 0) {
+        if (timer_elapsed32(frame_start) < FB_CAPTURE_FRAME_MS) {
+            return;
+        }
+        frame_start = timer_read32();
+        if (!slave) {
+            memcpy(master_frame, oled_read_raw(0).current_element, OLED_MATRIX_SIZE);
+        }
+    }
+    last_step = timer_read32();
+
+    uint8_t window[FB_WINDOW];
+    if (!read_window(window)) {
+        return; // slave busy or gone; retried next step
+    }
+
+    diff_window(window);
+    cursor += FB_WINDOW;
+
+    if (cursor == OLED_MATRIX_SIZE) {
+        report_send(true);
+        cursor   = 0;
+        keyframe = false;
+        frame++;
+    }
+}
+
+void fb_capture_raw_hid(uint8_t *data, uint8_t length) {
+    uint8_t half = data[1];
+
+    if (half == FB_STOP) {
+        active = false;
+    } else if (!active || slave != (half != 0)) {
+        fb_capture_start(half != 0);
+    }
+    renewed = timer_read32();
+}
+
+#else
+void fb_capture_init(void) {}
+void fb_capture_task(void) {}
+void fb_capture_raw_hid(uint8_t *data, uint8_t length) {}
+#endif
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include QMK_KEYBOARD_H
+
+// Streams either half's OLED buffer to the host over raw HID: a keyframe,
+// then only the bytes that changed. One window is diffed and sent per
+// FB_CAPTURE_STEP_MS, so the split link and the scan loop never see a burst:
+// the master's buffer from a copy taken when the frame starts, the slave's
+// read over FB_CAPTURE_SYNC. Opt-in with FB_CAPTURE_ENABLE; it keeps the last
+// frame sent and the master's frame copy, 2 * OLED_MATRIX_SIZE bytes of RAM.
+#ifndef FB_CAPTURE_STEP_MS
+#    define FB_CAPTURE_STEP_MS 4
+#endif
+
+// Shortest time from the start of one frame to the next
+#ifndef FB_CAPTURE_FRAME_MS
+#    define FB_CAPTURE_FRAME_MS 100
+#endif
+
+// Capture stops if the host has not renewed it for this long
+#ifndef FB_CAPTURE_TIMEOUT_MS
+#    define FB_CAPTURE_TIMEOUT_MS 3000
+#endif
+
+#define FB_CAPTURE_HID_COMMAND 'F'
+
+void fb_capture_init(void);
+void fb_capture_task(void);
+
+void fb_capture_raw_hid(uint8_t *data, uint8_t length);
@@ -0,0 +1,91 @@
+/**
+ * @file game_profile.c
+ * @brief Reduced-work profile tied to the _GAME layer
+ *
+ * Debounce algorithm and split transport flags are compile-time in QMK, so
+ * the profile cuts per-loop work instead: every task skipped here is time the
+ * main loop spends scanning the matrix. The loop rate of the last full second
+ * is kept for each profile so the two can be compared over raw HID.
+ */
+
+#include "game_profile.h"
+#include "constants.h"
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#endif
+
+static bool gaming = false;
+#ifdef RGB_MATRIX_ENABLE
+static uint8_t saved_rgb_mode;
+#endif
+
+static uint32_t loop_window = 0;
+static uint32_t loop_count  = 0;
+static uint32_t loop_rate[2]; // loops per second, [0] normal, [1] gaming
+
+void game_profile_update(layer_state_t state) {
+    bool active = state & ((layer_state_t)1 << _GAME);
+    if (active == gaming) {
+        return;
+    }
+    gaming = active;
+
+#ifdef RGB_MATRIX_ENABLE
+    // noeeprom so the profile never touches the stored mode
+    if (gaming) {
+        saved_rgb_mode = rgb_matrix_get_mode();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    } else {
+        rgb_matrix_mode_noeeprom(saved_rgb_mode);
+    }
+#endif
+
+    // Start a fresh window so no second straddles both profiles
+    loop_window = timer_read32();
+    loop_count  = 0;
+}
+
+bool game_profile_active(void) {
+    return layer_state_is(_GAME);
+}
+
+bool game_profile_oled_paused(void) {
+    static bool     was_active = false;
+    static uint32_t entered    = 0;
+
+    bool active = game_profile_active();
+    if (active && !was_active) {
+        entered = timer_read32();
+    }
+    was_active = active;
+
+    return active && timer_elapsed32(entered) >= GAME_PROFILE_OLED_SETTLE_MS;
+}
+
+void game_profile_task(void) {
+    loop_count++;
+    if (timer_elapsed32(loop_window) >= 1000) {
+        loop_rate[gaming] = loop_count;
+        loop_window       = timer_read32();
+        loop_count        = 0;
+    }
+}
+
+#ifdef RAW_ENABLE
+// Response: 'G', active, loops/s normal (u32), loops/s gaming (u32). Big-endian.
+void game_profile_raw_hid(uint8_t *data, uint8_t length) {
+    memset(&data[1], 0, length - 1);
+    data[1] = gaming;
+
+    for (uint8_t i = 0; i < 2; i++) {
+        uint8_t *out = &data[2 + i * 4];
+
+        out[0] = (uint8_t)(loop_rate[i] >> 24);
+        out[1] = (uint8_t)(loop_rate[i] >> 16);
+        out[2] = (uint8_t)(loop_rate[i] >> 8);
+        out[3] = (uint8_t)loop_rate[i];
+    }
+
+    raw_hid_send(data, length);
+}
+#endif
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include QMK_KEYBOARD_H
+
+// Lighter runtime profile while _GAME is on: the RGB effect drops to a solid
+// colour, OLED animation and the user indicator passes pause, and optional
+// split syncs are held back. Leaving the layer restores all of it.
+#define GAME_PROFILE_HID_COMMAND 'G'
+
+#ifndef GAME_PROFILE_OLED_SETTLE_MS
+#    define GAME_PROFILE_OLED_SETTLE_MS 500
+#endif
+
+// Layer-state hook on the master; safe to call on every layer change.
+void game_profile_update(layer_state_t state);
+
+// True on either half while _GAME is on (layer state is synced to the slave).
+bool game_profile_active(void);
+
+// True once _GAME has been on long enough for the layer label to settle; the
+// OLED then keeps its last frame.
+bool game_profile_oled_paused(void);
+
+// Once per main loop; counts loop iterations for the scan-rate report.
+void game_profile_task(void);
+void game_profile_raw_hid(uint8_t *data, uint8_t length);
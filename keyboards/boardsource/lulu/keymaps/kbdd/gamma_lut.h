@@ -0,0 +1,7 @@
+#pragma once
+
+// Generated by build_gamma.py (gamma 2.2), do not edit.
+
+#include QMK_KEYBOARD_H
+
+extern const uint8_t PROGMEM gamma_lut[256];
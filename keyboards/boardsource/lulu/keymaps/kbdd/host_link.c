@@ -0,0 +1,110 @@
+/**
+ * @file host_link.c
+ * @brief Raw HID requests to the host companion with keystroke fallback
+ *
+ * Keys typed while a request is waiting are held by the key queue, so they
+ * still land after whatever the fallback types.
+ */
+
+#include "host_link.h"
+#include "key_queue.h"
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#endif
+
+static uint8_t              pending_command  = 0;
+static uint8_t              pending_seq      = 0;
+static host_link_callback_t pending_handled  = NULL;
+static host_link_callback_t pending_fallback = NULL;
+static deferred_token       pending_timeout  = INVALID_DEFERRED_TOKEN;
+
+static bool     host_absent = false;
+static uint32_t absent_since;
+
+static void host_link_finish(bool handled) {
+    host_link_callback_t callback = handled ? pending_handled : pending_fallback;
+
+    pending_command  = 0;
+    pending_handled  = NULL;
+    pending_fallback = NULL;
+    pending_timeout  = INVALID_DEFERRED_TOKEN;
+
+    // Either may start a macro, which takes its own hold first
+    if (callback) {
+        callback();
+    }
+    key_queue_release();
+}
+
+static void host_link_verdict(host_link_verdict_t verdict) {
+#ifdef RAW_ENABLE
+    uint8_t report[HOST_LINK_REPORT_SIZE] = {HOST_LINK_VERDICT_COMMAND, pending_command, pending_seq, verdict};
+    raw_hid_send(report, sizeof(report));
+#endif
+}
+
+static uint32_t host_link_timeout(uint32_t trigger_time, void *cb_arg) {
+    host_absent  = true;
+    absent_since = timer_read32();
+    // A late acknowledgement may already be on its way
+    host_link_verdict(HOST_LINK_CANCEL);
+    host_link_finish(false);
+    return 0;
+}
+
+bool host_link_busy(void) {
+    return pending_command != 0;
+}
+
+bool host_link_available(void) {
+    return !host_absent || timer_elapsed32(absent_since) >= HOST_LINK_ABSENT_MS;
+}
+
+bool host_link_request(uint8_t command, const uint8_t *payload, uint8_t length, host_link_callback_t handled, host_link_callback_t fallback) {
+    if (host_link_busy()) {
+        return false;
+    }
+
+    if (!host_link_available()) {
+        if (fallback) {
+            fallback();
+        }
+        return true;
+    }
+
+#ifdef RAW_ENABLE
+    uint8_t report[HOST_LINK_REPORT_SIZE] = {command, ++pending_seq};
+    memcpy(&report[2], payload, MIN(length, HOST_LINK_PAYLOAD_SIZE));
+
+    pending_command  = command;
+    pending_handled  = handled;
+    pending_fallback = fallback;
+    key_queue_hold();
+
+    pending_timeout = defer_exec(HOST_LINK_TIMEOUT_MS, host_link_timeout, NULL);
+    if (pending_timeout == INVALID_DEFERRED_TOKEN) {
+        host_link_finish(false);
+        return true;
+    }
+
+    raw_hid_send(report, sizeof(report));
+#else
+    if (fallback) {
+        fallback();
+    }
+#endif
+    return true;
+}
+
+void host_link_raw_hid(uint8_t *data, uint8_t length) {
+    if (!pending_command || data[0] != pending_command || data[1] != pending_seq) {
+        return; // late or unsolicited
+    }
+
+    host_absent = false;
+    cancel_deferred_exec(pending_timeout);
+    if (data[2] == 0) {
+        host_link_verdict(HOST_LINK_GO);
+    }
+    host_link_finish(data[2] == 0);
+}
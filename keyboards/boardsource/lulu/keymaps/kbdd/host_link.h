@@ -0,0 +1,58 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include QMK_KEYBOARD_H
+
+// Request/acknowledge channel to a host companion over raw HID. The keyboard
+// sends [command, seq, payload...]; the companion answers [command, seq,
+// status]. On a zero status the request's handled callback runs; without an
+// acknowledgement within HOST_LINK_TIMEOUT_MS, or with a non-zero status, its
+// fallback runs instead. After a timeout the companion is assumed absent for
+// HOST_LINK_ABSENT_MS and fallbacks run straight away.
+//
+// An acknowledgement can cross the timeout on the wire, so the companion
+// does not act on its own acknowledgement: the keyboard settles every
+// request it acknowledged or timed out with [HOST_LINK_VERDICT_COMMAND,
+// command, seq, verdict], and the companion acts only on HOST_LINK_GO.
+#ifndef HOST_LINK_TIMEOUT_MS
+#    define HOST_LINK_TIMEOUT_MS 50
+#endif
+
+#ifndef HOST_LINK_ABSENT_MS
+#    define HOST_LINK_ABSENT_MS 30000
+#endif
+
+#define HOST_LINK_REPORT_SIZE 32
+#define HOST_LINK_PAYLOAD_SIZE (HOST_LINK_REPORT_SIZE - 2) // after [command, seq]
+
+#define HOST_ACTION_HID_COMMAND 'A'
+#define HOST_LINK_VERDICT_COMMAND 'V'
+
+typedef enum {
+    HOST_LINK_GO,     // acknowledged in time; the companion carries it out
+    HOST_LINK_CANCEL, // timed out; the fallback has run instead
+} host_link_verdict_t;
+
+// Actions the companion carries out itself (lulu.py daemon)
+typedef enum {
+    HOST_ACTION_SEND_TO_NEW_TAB = 1, // open the clipboard in a new browser tab
+    HOST_ACTION_BLUETOOTH_TOGGLE,    // toggle the host's Bluetooth radio
+} host_action_t;
+
+typedef void (*host_link_callback_t)(void);
+
+// One request in flight at a time; returns false (and runs nothing) if busy.
+// Either callback may be NULL.
+bool host_link_request(uint8_t command, const uint8_t *payload, uint8_t length, host_link_callback_t handled, host_link_callback_t fallback);
+
+#define host_action(action, handled, fallback) host_link_request(HOST_ACTION_HID_COMMAND, &(uint8_t){(action)}, 1, (handled), (fallback))
+
+// True while a request is waiting for its acknowledgement
+bool host_link_busy(void);
+
+// False while the companion is presumed absent after a timeout
+bool host_link_available(void);
+
+// Acknowledgements from raw_hid_receive()
+void host_link_raw_hid(uint8_t *data, uint8_t length);
@@ -0,0 +1,29 @@
+#pragma once
+
+// Marks a function for the key path. On the RP2040 it is linked into a
+// .time_critical.* section, which the QMK linker script copies to SRAM at
+// boot (the same mechanism as pico-sdk's __not_in_flash_func()), so it never
+// stalls on an XIP cache miss. AVR executes from flash anyway, so this is a
+// no-op there. Define HOT_PATH_IN_FLASH to compare against flash placement.
+//
+//     bool HOT_PATH(process_record_user)(uint16_t keycode, keyrecord_t *record) { ... }
+//
+// run ram_func_report.py on the build's .map file to confirm placement.
+//
+// The gain is in press-to-report jitter, which has not been measured on this
+// keymap yet: it needs the board and a host-side capture of report arrival
+// (a USB analyser, or usbmon timestamps against a switch driven by a signal
+// generator), once with HOT_PATH_IN_FLASH defined and once without.
+//
+// HOT_DATA() does the same for const bitmaps drawn every frame, so they are
+// read from SRAM without a copy or lookup at draw time. Use it in place of
+// PROGMEM, which is a no-op on the RP2040 but still needed on AVR.
+//
+//     const uint8_t HOT_DATA(horizon_0)[] = { ... };
+#if defined(MCU_RP) && !defined(HOT_PATH_IN_FLASH)
+#    define HOT_PATH(name) __attribute__((noinline, section(".time_critical." #name))) name
+#    define HOT_DATA(name) __attribute__((section(".time_critical." #name))) name
+#else
+#    define HOT_PATH(name) name
+#    define HOT_DATA(name) PROGMEM name
+#endif
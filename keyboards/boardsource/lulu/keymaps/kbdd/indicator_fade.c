@@ -0,0 +1,149 @@
+/**
+ * @file indicator_fade.c
+ * @brief Fixed-point indicator brightness with an eased transition
+ *
+ * Replaces the lumino module's floating-point easing with integer arithmetic.
+ * The lumino levels are floats in config.h, folded into Q8 integers at
+ * compile time, and the per-frame work is a table lookup and one
+ * interpolation. No cycle count has been taken on either target, so this
+ * makes no claim to be faster than the float version. The output stage
+ * applies the level and gamma_lut together, so every indicator is gamma
+ * corrected.
+ */
+
+#include "indicator_fade.h"
+#include "gamma_lut.h"
+#include "settings.h"
+
+#ifndef LUMINO_HIGH_BRIGHTNESS
+#    define LUMINO_HIGH_BRIGHTNESS 1.0
+#endif
+#ifndef LUMINO_LOW_BRIGHTNESS
+#    define LUMINO_LOW_BRIGHTNESS 0.5
+#endif
+
+#ifndef RGB_MATRIX_MAXIMUM_BRIGHTNESS
+#    define RGB_MATRIX_MAXIMUM_BRIGHTNESS UINT8_MAX
+#endif
+
+#define Q8(x) ((uint8_t)((x) * 255 + 0.5))
+
+#define FADE_HIGH Q8(LUMINO_HIGH_BRIGHTNESS)
+#define FADE_LOW Q8(LUMINO_LOW_BRIGHTNESS)
+
+// Smoothstep, 3t^2 - 2t^3, sampled at 33 points in Q8
+#define FADE_EASE_STEPS 32
+static const uint8_t PROGMEM fade_ease[FADE_EASE_STEPS + 1] = {
+    0, 1, 3, 6, 11, 17, 24, 31, 40, 49, 59, 70, 81, 92, 104, 116, 128, 139, 151, 163, 174, 185, 196, 206, 215, 224, 231, 238, 244, 249, 252, 254, 255,
+};
+
+static uint8_t  fade_awake  = FADE_HIGH;
+static uint8_t  fade_from   = FADE_HIGH;
+static uint8_t  fade_to     = FADE_HIGH;
+static uint8_t  fade_level  = FADE_HIGH;
+static uint8_t  fade_shown  = FADE_HIGH;
+static uint32_t fade_start  = 0;
+static bool     fade_moving = false;
+
+// Length and table position per millisecond, Q16, taken together when a fade
+// starts; the transition time is a runtime setting, and a change mid-fade
+// must not move the end past the table
+static uint16_t fade_duration;
+static uint32_t fade_step_q16;
+
+static uint8_t fade_target(void) {
+    uint32_t idle = last_input_activity_elapsed();
+
+    if (idle >= settings.lumino_long_ms) {
+        return 0;
+    }
+    if (idle >= settings.lumino_soon_ms && fade_awake > FADE_LOW) {
+        return FADE_LOW;
+    }
+    return fade_awake;
+}
+
+void indicator_fade_cycle(void) {
+    fade_awake = fade_awake == FADE_HIGH ? FADE_LOW : fade_awake == FADE_LOW ? 0 : FADE_HIGH;
+}
+
+// The matrix value for a Q8 level, and back; the same rounding both ways so
+// a level survives the trip through the synced config
+static uint8_t fade_to_val(uint8_t level) {
+    return (level * RGB_MATRIX_MAXIMUM_BRIGHTNESS + 127) / 255;
+}
+
+static uint8_t fade_from_val(uint8_t val) {
+    return (val * 255 + RGB_MATRIX_MAXIMUM_BRIGHTNESS / 2) / RGB_MATRIX_MAXIMUM_BRIGHTNESS;
+}
+
+// elapsed < fade_duration, so idx + 1 stays within the table
+static uint8_t fade_ease_at(uint32_t elapsed) {
+    uint32_t pos  = elapsed * fade_step_q16;
+    uint8_t  idx  = pos >> 16;
+    uint8_t  frac = (pos >> 8) & 0xFF;
+    uint8_t  a    = pgm_read_byte(&fade_ease[idx]);
+    uint8_t  b    = pgm_read_byte(&fade_ease[idx + 1]);
+
+    return a + (((b - a) * frac) >> 8);
+}
+
+static void fade_step(void) {
+    uint8_t target = fade_target();
+    if (target != fade_to) {
+        // Retarget from wherever the current fade has got to
+        fade_from   = fade_level;
+        fade_to     = target;
+        fade_start  = timer_read32();
+        fade_moving = true;
+
+        fade_duration = settings.lumino_transition_ms;
+        fade_step_q16 = ((uint32_t)FADE_EASE_STEPS << 16) / fade_duration;
+    }
+
+    if (!fade_moving) {
+        return;
+    }
+
+    uint32_t elapsed = timer_elapsed32(fade_start);
+    if (elapsed >= fade_duration) {
+        fade_level  = fade_to;
+        fade_moving = false;
+        return;
+    }
+
+    uint8_t ease = fade_ease_at(elapsed);
+    if (fade_to > fade_from) {
+        fade_level = fade_from + (((fade_to - fade_from) * ease) >> 8);
+    } else {
+        fade_level = fade_from - (((fade_from - fade_to) * ease) >> 8);
+    }
+}
+
+void indicator_fade_task(void) {
+    // The master owns the level; both halves read it back out of the matrix
+    // value, which QMK syncs to the slave, so their indicators match.
+    if (is_keyboard_master()) {
+        fade_step();
+        uint8_t val = fade_to_val(fade_level);
+        if (val != rgb_matrix_get_val()) {
+            rgb_matrix_sethsv_noeeprom(rgb_matrix_get_hue(), rgb_matrix_get_sat(), val);
+        }
+    }
+    fade_shown = fade_from_val(rgb_matrix_get_val());
+}
+
+// Output stage: brightness scaling in perceptual space, then gamma to PWM
+// duty. x * (level + 1) >> 8 keeps full level exact: 255 * 256 >> 8 == 255.
+static uint8_t output_value(uint8_t value, uint8_t level) {
+    return pgm_read_byte(&gamma_lut[(value * (level + 1)) >> 8]);
+}
+
+// A multiply and a flash read per channel. A table folding the level in
+// would have to be rebuilt on every frame of a fade, which costs more than
+// it saves for the few indicator LEDs drawn.
+void indicator_fade_apply(rgb_t *rgb) {
+    rgb->r = output_value(rgb->r, fade_shown);
+    rgb->g = output_value(rgb->g, fade_shown);
+    rgb->b = output_value(rgb->b, fade_shown);
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdint.h>
+#include QMK_KEYBOARD_H
+
+// RGB brightness and idle fade, in place of the lumino module. The master
+// sets the matrix value (V) from the activity levels: high while typing, low
+// after the lumino soon timeout and off after the long one, easing between
+// them over the lumino transition setting, all in Q8 fixed point. QMK syncs
+// V to the slave with the rest of the RGB matrix config. The keymap's own
+// indicators, which rgb_matrix_set_color() draws at full value, are scaled
+// by the same V on both halves.
+
+// Once per RGB frame, before any indicator is drawn
+void indicator_fade_task(void);
+
+// LUMINO key: cycle the awake brightness, high, low, off; not persisted
+void indicator_fade_cycle(void);
+
+// Final per-LED output stage: scale to the current brightness and gamma
+// correct, a multiply and one table lookup per channel
+void indicator_fade_apply(rgb_t *rgb);
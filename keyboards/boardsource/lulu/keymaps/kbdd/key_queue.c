@@ -0,0 +1,97 @@
+/**
+ * @file key_queue.c
+ * @brief Ordered, timestamped key event buffer for the duration of macros
+ *
+ * Events are captured in pre_process_record_user(), ahead of the tapping
+ * state machine, so a replayed event goes through exactly the pipeline it
+ * skipped. If the queue is full when an event arrives, the queued events are
+ * replayed first and the new one is queued behind them, so no event ever
+ * runs ahead of one typed before it. The cost is that the flushed events land
+ * inside the macro's output; that is counted as an overflow.
+ */
+
+#include "key_queue.h"
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#endif
+
+static keyevent_t queue[KEY_QUEUE_SIZE];
+static uint8_t    head      = 0;
+static uint8_t    count     = 0;
+static uint8_t    holders   = 0;
+static bool       replaying = false;
+
+static uint8_t  high_water = 0;
+static uint16_t queued     = 0;
+static uint16_t overflows  = 0;
+
+void key_queue_hold(void) {
+    holders++;
+}
+
+// Replays from the head until empty, or, unless flushing, until a replayed
+// event starts another macro that holds again.
+static void key_queue_replay(bool flush) {
+    bool nested = replaying;
+
+    replaying = true;
+    while (count && (flush || holders == 0)) {
+        keyevent_t event = queue[head];
+        head             = (head + 1) % KEY_QUEUE_SIZE;
+        count--;
+        action_exec(event);
+    }
+    replaying = nested;
+}
+
+void key_queue_release(void) {
+    if (holders == 0 || --holders > 0) {
+        return;
+    }
+
+    // Whatever a newly started macro leaves queued waits for its release
+    key_queue_replay(false);
+}
+
+bool key_queue_holding(void) {
+    return holders > 0 && !replaying;
+}
+
+bool key_queue_process(keyrecord_t *record) {
+    if (!key_queue_holding() || !IS_EVENT(record->event)) {
+        return true;
+    }
+
+    if (count == KEY_QUEUE_SIZE) {
+        if (overflows < UINT16_MAX) {
+            overflows++;
+        }
+        key_queue_replay(true);
+    }
+
+    queue[(head + count) % KEY_QUEUE_SIZE] = record->event;
+    count++;
+
+    if (count > high_water) {
+        high_water = count;
+    }
+    if (queued < UINT16_MAX) {
+        queued++;
+    }
+    return false;
+}
+
+#ifdef RAW_ENABLE
+// Response: 'Q', capacity, high water, queued (u16), overflows (u16). Big-endian.
+void key_queue_raw_hid(uint8_t *data, uint8_t length) {
+    memset(&data[1], 0, length - 1);
+    data[1] = KEY_QUEUE_SIZE;
+    data[2] = high_water;
+    data[3] = (uint8_t)(queued >> 8);
+    data[4] = (uint8_t)queued;
+    data[5] = (uint8_t)(overflows >> 8);
+    data[6] = (uint8_t)overflows;
+
+    raw_hid_send(data, length);
+}
+#endif
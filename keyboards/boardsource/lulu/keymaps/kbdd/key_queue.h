@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include QMK_KEYBOARD_H
+
+// Holds key events that arrive while a multi-step macro is still typing, so
+// they come out after it instead of interleaved with it. Events keep their
+// original timestamps and are replayed through action_exec() in order, so
+// tap/hold decisions come out as they were typed.
+//
+// This does not sample the matrix: a transition that starts and ends inside
+// one blocking call is still lost. Nothing in this keymap blocks for long
+// instead: macros and strings run on the deferred executor, OLED flushes go
+// through oled_task()'s OLED_UPDATE_PROCESS_LIMIT and settings are written
+// to EEPROM only once typing has stopped. The exception is QMK's own Unicode
+// input, used when the host companion is not running, which waits
+// UNICODE_TYPE_DELAY between steps as the host input method needs.
+#ifndef KEY_QUEUE_SIZE
+#    define KEY_QUEUE_SIZE 16
+#endif
+
+#define KEY_QUEUE_HID_COMMAND 'Q'
+
+// Nesting; events are held while the count is non-zero, and replayed when
+// the last holder releases.
+void key_queue_hold(void);
+void key_queue_release(void);
+
+// True while new events would be queued
+bool key_queue_holding(void);
+
+// From pre_process_record_user(): returns false if the event was queued.
+bool key_queue_process(keyrecord_t *record);
+
+void key_queue_raw_hid(uint8_t *data, uint8_t length);
@@ -5,10 +5,25 @@
 
 #include "constants.h"
 #include "anim.h"
+#include "boot_timing.h"
+#include "widget_watchdog.h"
+#include "game_profile.h"
+#include "encoder_feedback.h"
+#include "key_queue.h"
+#include "macro_seq.h"
+#include "indicator_fade.h"
+#include "keymap_cache.h"
+#include "host_link.h"
+#include "unicode_batch.h"
+#include "snippets.h"
+#include "macro_rec.h"
+#include "settings.h"
+#include "fb_capture.h"
+#include "event_bus.h"
+#include "hot_path.h"
 
 #include "wpm_oled.h"
 #include "oled_utils.h"
-#include "dmyoung9/encoder_ledmap.h"
 #include "elpekenin/indicators.h"
 #include "elpekenin/colors.h"
 
@@ -33,9 +48,28 @@ static bool oneshot_shift_active = false;
 // Slug lock timeout functionality
 static bool slug_lock_active = false;
 static uint32_t slug_lock_timer = 0;
-#define SLUG_LOCK_TIMEOUT 3000  // 3000ms timeout
+
+static void HOT_PATH(set_slug_lock)(bool active) {
+    slug_lock_active = active;
+    event_post(EVENT_SLUG_LOCK, active, CUS_SLK);
+}
 
 #ifdef SPLIT_KEYBOARD
+// Split syncs dropped by split_sync.h, so the build log says what no longer
+// crosses the link and how much each update of it was
+#    ifndef SPLIT_WPM_ENABLE
+#        pragma message("split sync: WPM not needed on the slave, saves its " SPLIT_SYNC_XSTR(SYNC_WPM_BYTES) "-byte payload per update")
+#    endif
+#    ifndef SPLIT_MODS_ENABLE
+#        pragma message("split sync: mods not needed on the slave, saves its " SPLIT_SYNC_XSTR(SYNC_MODS_BYTES) "-byte payload per update")
+#    endif
+#    ifndef SPLIT_LAYER_STATE_ENABLE
+#        pragma message("split sync: layer state not needed on the slave, saves its " SPLIT_SYNC_XSTR(SYNC_LAYER_BYTES) "-byte payload per update")
+#    endif
+#    ifndef SPLIT_ACTIVITY_ENABLE
+#        pragma message("split sync: activity not needed on the slave, saves its " SPLIT_SYNC_XSTR(SYNC_ACTIVITY_BYTES) "-byte payload per update")
+#    endif
+
 static uint32_t last_sync_timestamp = 0;
 static bool     sync_pending        = false;
 #endif
@@ -191,7 +225,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
 
 [_FUNC] = LAYOUT(
     QK_BOOT, _______, _______, _______, _______, _______,                   _______, _______, _______, _______, _______, _______,
-    _______, _______, _______, _______, G_REC  , _______,                   G_SNIP , KC_F9  , KC_F10 , KC_F11 , KC_F12 , _______,
+    _______, CUS_MREC,CUS_MPLY,CUS_MPLT,G_REC  , _______,                   G_SNIP , KC_F9  , KC_F10 , KC_F11 , KC_F12 , _______,
     _______, _______, _______, _______, _______, _______,                   _______, KC_F5  , KC_F6  , KC_F7  , KC_F8  , _______,
     _______, _______, _______, _______, _______, _______, LUMINO ,TG(_GAME),_______, KC_F1  , KC_F2  , KC_F3  , KC_F4  , _______,
                                _______, _______, _______, _______, _______, _______, _______, _______
@@ -227,6 +261,7 @@ const color_t PROGMEM encoder_ledmap[][NUM_ENCODERS][NUM_DIRECTIONS] = {
     [5] = { { TRNS_COLOR, TRNS_COLOR } },
     // [6] = { { HUE(HUE_PURPLE), HUE(HUE_PURPLE) } },
 };
+const uint8_t encoder_ledmap_layers = ARRAY_SIZE(encoder_ledmap);
 #endif
 
 #ifdef COMBO_ENABLE
@@ -248,20 +283,54 @@ combo_t key_combos[] = {
 #endif
 
 #ifdef OLED_ENABLE
+static render_state_t render_state;
+static bool           horizon_drawn;
+
+static void draw_horizon_widget(const render_state_t *state) {
+    draw_horizon();
+}
+
+static void draw_clock_widget(const render_state_t *state) {
+    // The clock draws additively and relies on the horizon clearing the
+    // screen. A reduced horizon still does, just not every frame, so leave
+    // the last clock up until it does; past that the clock has to clear its
+    // own digits.
+    if (!horizon_drawn) {
+        if (widget_level(WIDGET_HORIZON) == WIDGET_LEVEL_REDUCED) {
+            return;
+        }
+        clear_rect(80, 5, 48, 8);
+    }
+    draw_clock(state);
+}
+
 bool oled_task_user(void) {
-    if (last_input_activity_elapsed() < OLED_TIMEOUT) {
+    if (last_input_activity_elapsed() < settings.oled_timeout_ms) {
+        if (!is_oled_on()) {
+            // Off time is not a stall
+            anim_resync();
+        }
         oled_on();
     } else {
         oled_off();
         return false;
     }
 
+    if (game_profile_oled_paused()) {
+        anim_resync();
+        return false;
+    }
+
+    // Widgets only ever see the latest published snapshot, never live state;
+    // housekeeping_task_user() is the producer.
+    render_state_consume(&render_state);
+
     if (!is_keyboard_master()) {
-        draw_horizon();
-        draw_clock();
+        horizon_drawn = widget_run(WIDGET_HORIZON, draw_horizon_widget, &render_state);
+        widget_run(WIDGET_CLOCK, draw_clock_widget, &render_state);
     } else {
-        tick_widgets();
-        draw_wpm_frame();
+        widget_run(WIDGET_STATUS, tick_widgets, &render_state);
+        widget_run(WIDGET_WPM, draw_wpm_frame, &render_state);
     }
 
     return false;
@@ -274,29 +343,67 @@ oled_rotation_t oled_init_user(oled_rotation_t rotation) {
 
 #ifdef RAW_ENABLE
 void raw_hid_receive(uint8_t *data, uint8_t length) {
-    if (is_keyboard_master()) {
-        // Data format: [0] = 'T', [1..4] = uint32_t timestamp
-        if (data[0] == 'T') {
+    if (!is_keyboard_master()) {
+        return;
+    }
+
+    switch (data[0]) {
+        case 'T': {
+            // Data format: [0] = 'T', [1..4] = uint32_t timestamp
             uint32_t timestamp = ((uint32_t)data[1] << 24) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 8) | ((uint32_t)data[4]);
 
 #ifdef SPLIT_KEYBOARD
             last_sync_timestamp = timestamp;
             sync_pending        = true;
 #endif
+            break;
         }
+        case BOOT_TIMING_HID_COMMAND:
+            boot_timing_raw_hid(data, length);
+            break;
+        case WIDGET_WATCHDOG_HID_COMMAND:
+            widget_watchdog_raw_hid(data, length);
+            break;
+        case GAME_PROFILE_HID_COMMAND:
+            game_profile_raw_hid(data, length);
+            break;
+        case KEY_QUEUE_HID_COMMAND:
+            key_queue_raw_hid(data, length);
+            break;
+        case HOST_ACTION_HID_COMMAND:
+        case UNICODE_BATCH_HID_COMMAND:
+            host_link_raw_hid(data, length);
+            break;
+        case SETTINGS_HID_COMMAND:
+            settings_raw_hid(data, length);
+            break;
+        case FB_CAPTURE_HID_COMMAND:
+            fb_capture_raw_hid(data, length);
+            break;
     }
 }
 #endif
 
-#ifdef SPLIT_KEYBOARD
 void housekeeping_task_user(void) {
-    if (is_keyboard_master() && sync_pending) {
+#ifdef OLED_ENABLE
+    render_state_publish();
+#endif
+    boot_timing_task();
+    game_profile_task();
+    encoder_feedback_task();
+    settings_task();
+    fb_capture_task();
+    macro_seq_task();
+
+#ifdef SPLIT_KEYBOARD
+    // The clock can wait until the game layer is off again
+    if (is_keyboard_master() && sync_pending && !game_profile_active()) {
         if (transaction_rpc_send(CLOCK_SYNC, sizeof(last_sync_timestamp), &last_sync_timestamp)) {
             sync_pending = false;
         }
     }
-}
 #endif
+}
 
 #ifdef SPLIT_KEYBOARD
 void clock_sync_slave_handler(uint8_t in_buflen, const void *in_data, uint8_t out_buflen, void *out_data) {
@@ -307,7 +414,15 @@ void clock_sync_slave_handler(uint8_t in_buflen, const void *in_data, uint8_t ou
 }
 #endif
 
+void keyboard_pre_init_user(void) {
+    boot_timing_init();
+}
+
 void keyboard_post_init_user(void) {
+    boot_timing_mark(BOOT_STAMP_POST_INIT);
+    settings_init();
+    keymap_cache_init();
+
     oled_clear();
 
     if (is_keyboard_master()) {
@@ -316,32 +431,95 @@ void keyboard_post_init_user(void) {
 
 #ifdef SPLIT_KEYBOARD
     transaction_register_rpc(CLOCK_SYNC, clock_sync_slave_handler);
+    boot_timing_mark(BOOT_STAMP_CLOCK_RPC);
 #endif
+    fb_capture_init();
+    widget_watchdog_init();
 }
 
-layer_state_t layer_state_set_user(layer_state_t state) {
-    if (is_keyboard_master()) {
-        tick_widgets();
+void suspend_wakeup_init_user(void) {
+    boot_timing_wake();
+}
+
+#ifdef RGB_MATRIX_ENABLE
+bool shutdown_user(bool jump_to_bootloader) {
+    // Lit until the bootloader takes over, so it is clear the board is in it
+    if (jump_to_bootloader) {
+        rgb_matrix_set_color_all(LUMINO_BOOT_COLOR);
+        rgb_matrix_update_pwm_buffers();
     }
+    return true;
+}
+#endif
+
+layer_state_t layer_state_set_user(layer_state_t state) {
 #ifdef TRI_LAYER_ENABLE
-    return update_tri_layer_state(state, _NUM, _NAV, _FUNC);
+    state = update_tri_layer_state(state, _NUM, _NAV, _FUNC);
 #endif
+    // Layer widgets pick the change up from the next render snapshot, keeping
+    // OLED composition out of the key path.
+    event_post(EVENT_LAYER, get_highest_layer(state), KC_NO);
+    game_profile_update(state);
     return state;
 }
 
-void matrix_scan_user(void) {
+void HOT_PATH(matrix_scan_user)(void) {
+    boot_timing_mark(BOOT_STAMP_FIRST_SCAN);
+
     // if (task_layer_active && timer_elapsed32(task_layer_timer) > TASK_LAYER_TIMEOUT) {
     //     tap_code(KC_ESC);
     //     layer_off(_TASK);
     //     task_layer_active = false;
     // }
 
-    if (slug_lock_active && timer_elapsed32(slug_lock_timer) > SLUG_LOCK_TIMEOUT) {
-        slug_lock_active = false;
+    if (slug_lock_active && timer_elapsed32(slug_lock_timer) > settings.slug_lock_ms) {
+        set_slug_lock(false);
     }
 }
 
-bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+// Copy, open a new tab, paste and go
+MACRO_SEQ(send_to_new_tab_macro, {C(KC_C), 100}, {C(KC_T), 100}, {C(KC_V), 100}, {KC_ENT, 0});
+
+// Wrap the clipboard in a fenced code block
+static const char PROGMEM code_fence[] = "```";
+MACRO_SEQ(code_block_macro, MACRO_TEXT(code_fence, 0), {C(KC_J), 50}, {C(KC_V), 0}, {C(KC_J), 50}, MACRO_TEXT(code_fence, 0), {C(KC_J), 0});
+
+// Quick settings, Bluetooth tile, toggle, close
+MACRO_SEQ(bluetooth_toggle_macro, {G(KC_A), 500}, {KC_RIGHT, 500}, {KC_SPC, 500}, {KC_ESC, 0});
+
+// The companion reads the clipboard once it has acknowledged, so copy then
+static void send_to_new_tab_copy(void) {
+    tap_code16(C(KC_C));
+}
+
+// Keystroke versions of the host actions, for when no companion answers.
+// Behind a running macro, or with no executor free, they wait their turn.
+static void send_to_new_tab_fallback(void) {
+    MACRO_SEQ_START_SOON(send_to_new_tab_macro);
+}
+
+static void bluetooth_toggle_fallback(void) {
+    MACRO_SEQ_START_SOON(bluetooth_toggle_macro);
+}
+
+bool pre_process_record_user(uint16_t keycode, keyrecord_t *record) {
+    // Ahead of the queue, so an open batch is sent before the key that
+    // interrupts it is held back
+    if (!unicode_batch_process(keycode, record)) {
+        return false;
+    }
+    return key_queue_process(record);
+}
+
+bool HOT_PATH(process_record_user)(uint16_t keycode, keyrecord_t *record) {
+    event_post(EVENT_KEY, record->event.pressed, keycode);
+    encoder_feedback_note(record);
+    macro_rec_process(keycode, record);
+
+    if (!snippets_process(keycode, record)) {
+        return false;
+    }
+
     if (record->event.pressed) {
         // if (task_layer_active) {
         //     task_layer_timer = timer_read32();
@@ -370,34 +548,37 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
         case CUS_SLK:
             if (record->event.pressed) {
                 if (slug_lock_active) {
-                    slug_lock_active = false;
+                    set_slug_lock(false);
                 } else {
-                    slug_lock_active = true;
+                    set_slug_lock(true);
                     slug_lock_timer = timer_read32();
                 }
             }
             return false;
         case CUS_SNT:
             if (record->event.pressed) {
-                tap_code16(C(KC_C));
-                wait_ms(100);
-                tap_code16(C(KC_T));
-                wait_ms(100);
-                tap_code16(C(KC_V));
-                wait_ms(100);
-                tap_code(KC_ENT);
+                host_action(HOST_ACTION_SEND_TO_NEW_TAB, send_to_new_tab_copy, send_to_new_tab_fallback);
             }
             return false;
         case CUS_CODE:
             if (record->event.pressed) {
-                SEND_STRING("```");
-                tap_code16(C(KC_J));
-                wait_ms(50);
-                tap_code16(C(KC_V));
-                tap_code16(C(KC_J));
-                wait_ms(50);
-                SEND_STRING("```");
-                tap_code16(C(KC_J));
+                MACRO_SEQ_START(code_block_macro);
+            }
+            return false;
+        case CUS_MREC:
+            if (record->event.pressed) {
+                macro_rec_toggle();
+            }
+            return false;
+        case LUMINO:
+            if (record->event.pressed) {
+                indicator_fade_cycle();
+            }
+            return false;
+        case CUS_MPLY:
+        case CUS_MPLT:
+            if (record->event.pressed) {
+                macro_rec_play(keycode == CUS_MPLT);
             }
             return false;
 
@@ -420,7 +601,7 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
             break;
         case KC_SPC:
             if (record->event.pressed && slug_lock_active) {
-                slug_lock_active = false;
+                set_slug_lock(false);
             }
             break;
     }
@@ -430,6 +611,7 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
 
 void oneshot_mods_changed_user(uint8_t mods) {
     oneshot_shift_active = mods & MOD_MASK_SHIFT;
+    event_post(EVENT_ONESHOT_MODS, mods, KC_NO);
 }
 
 void td_bluetooth_mute_finished(tap_dance_state_t *state, void *user_data) {
@@ -437,13 +619,7 @@ void td_bluetooth_mute_finished(tap_dance_state_t *state, void *user_data) {
         // single tap
         tap_code(KC_MUTE);
     } else if (state->count == 2) {
-        tap_code16(G(KC_A));
-        wait_ms(500);
-        tap_code(KC_RIGHT);
-        wait_ms(500);
-        tap_code(KC_SPC);
-        wait_ms(500);
-        tap_code(KC_ESC);
+        host_action(HOST_ACTION_BLUETOOTH_TOGGLE, NULL, bluetooth_toggle_fallback);
     }
 }
 
@@ -457,28 +633,61 @@ void td_super_paren_finished(tap_dance_state_t *state, void *user_data) {
     }
 }
 
+// Indicator state, fed from the event bus instead of polling keymap globals
+static event_reader_t indicator_events;
+static bool           indicator_oneshot_shift = false;
+static bool           indicator_slug_lock     = false;
+
+static void drain_indicator_events(void) {
+    event_t event;
+    while (event_read(&indicator_events, &event)) {
+        switch (event.type) {
+            case EVENT_ONESHOT_MODS:
+                indicator_oneshot_shift = (event.value & MOD_MASK_SHIFT) != 0;
+                break;
+            case EVENT_SLUG_LOCK:
+                indicator_slug_lock = event.value;
+                break;
+        }
+    }
+
+    if (indicator_events.dropped) {
+        // Lost edges; fall back to the source of truth once.
+        indicator_oneshot_shift  = oneshot_shift_active;
+        indicator_slug_lock      = slug_lock_active;
+        indicator_events.dropped = 0;
+    }
+}
+
+static void set_indicator_color(uint8_t led, color_t color) {
+    rgb_t rgb;
+    get_rgb(color, &rgb);
+    indicator_fade_apply(&rgb);
+    rgb_matrix_set_color(led, rgb.r, rgb.g, rgb.b);
+}
+
 bool rgb_matrix_indicators_user(void) {
+    drain_indicator_events();
+    indicator_fade_task();
+    encoder_feedback_render();
+
+    // The _GAME layer colour comes from the indicators module; skip the rest
+    if (game_profile_active()) {
+        return true;
+    }
+
 #ifdef CAPS_WORD_ENABLE
     if (is_caps_word_on()) {
-        color_t orange = HUE(HUE_ORANGE);
-        rgb_t caps_word_rgb;
-        get_rgb(orange, &caps_word_rgb);
-        rgb_matrix_set_color(CAPS_WORD_LED_INDEX, caps_word_rgb.r, caps_word_rgb.g, caps_word_rgb.b);
+        set_indicator_color(CAPS_WORD_LED_INDEX, HUE(HUE_ORANGE));
     }
 #endif
 
-    if (oneshot_shift_active) {
-        color_t orange = HUE(HUE_ORANGE);
-        rgb_t oneshot_shift_rgb;
-        get_rgb(orange, &oneshot_shift_rgb);
-        rgb_matrix_set_color(ONESHOT_SHIFT_LED_INDEX, oneshot_shift_rgb.r, oneshot_shift_rgb.g, oneshot_shift_rgb.b);
+    if (indicator_oneshot_shift) {
+        set_indicator_color(ONESHOT_SHIFT_LED_INDEX, HUE(HUE_ORANGE));
     }
 
-    if (slug_lock_active) {
-        color_t orange = HUE(HUE_ORANGE);
-        rgb_t slug_lock_rgb;
-        get_rgb(orange, &slug_lock_rgb);
-        rgb_matrix_set_color(SLUG_LOCK_LED_INDEX, slug_lock_rgb.r, slug_lock_rgb.g, slug_lock_rgb.b);
+    if (indicator_slug_lock) {
+        set_indicator_color(SLUG_LOCK_LED_INDEX, HUE(HUE_ORANGE));
     }
 
     return true;
@@ -0,0 +1,63 @@
+/**
+ * @file keymap_cache.c
+ * @brief SRAM copy of the reachable keymap layers
+ *
+ * Every key event and every indicator pass resolves keycodes through
+ * keycode_at_keymap_location(). On the RP2040 the keymap sits in XIP flash,
+ * where a cold read stalls on the QSPI bus; a mirrored layer costs
+ * MATRIX_ROWS * MATRIX_COLS * 2 bytes of SRAM instead.
+ */
+
+#include "keymap_cache.h"
+#include "hot_path.h"
+
+#ifdef KEYMAP_CACHE_ENABLE
+#    ifdef DYNAMIC_KEYMAP_ENABLE
+#        error "KEYMAP_CACHE_ENABLE cannot be combined with DYNAMIC_KEYMAP_ENABLE"
+#    endif
+
+// Only as many slots as the budget allows
+#    define KEYMAP_CACHE_SLOTS __builtin_popcount(KEYMAP_CACHE_LAYER_MASK & ((1u << KEYMAP_CACHE_MAX_LAYERS) - 1))
+
+static uint16_t cache[KEYMAP_CACHE_SLOTS][MATRIX_ROWS][MATRIX_COLS];
+static uint8_t  cache_slot[KEYMAP_CACHE_MAX_LAYERS]; // layer -> slot, 0xFF if not cached
+static bool     cache_valid = false;
+
+void keymap_cache_init(void) {
+    uint8_t layers = keymap_layer_count();
+    uint8_t slots  = 0;
+
+    for (uint8_t layer = 0; layer < KEYMAP_CACHE_MAX_LAYERS; layer++) {
+        cache_slot[layer] = 0xFF;
+        if (layer >= layers || !(KEYMAP_CACHE_LAYER_MASK & (1u << layer)) || slots >= KEYMAP_CACHE_SLOTS) {
+            continue;
+        }
+
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                cache[slots][row][col] = keycode_at_keymap_location_raw(layer, row, col);
+            }
+        }
+        cache_slot[layer] = slots++;
+    }
+
+    cache_valid = true;
+}
+
+void keymap_cache_invalidate(void) {
+    cache_valid = false;
+}
+
+uint16_t HOT_PATH(keycode_at_keymap_location)(uint8_t layer_num, uint8_t row, uint8_t column) {
+    if (cache_valid && layer_num < KEYMAP_CACHE_MAX_LAYERS && row < MATRIX_ROWS && column < MATRIX_COLS) {
+        uint8_t slot = cache_slot[layer_num];
+        if (slot != 0xFF) {
+            return cache[slot][row][column];
+        }
+    }
+    return keycode_at_keymap_location_raw(layer_num, row, column);
+}
+#else
+void keymap_cache_init(void) {}
+void keymap_cache_invalidate(void) {}
+#endif
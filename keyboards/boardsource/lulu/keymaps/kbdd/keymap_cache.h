@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include QMK_KEYBOARD_H
+
+// SRAM mirror of the keymap, serving keycode_at_keymap_location() and so both
+// key processing and the indicators module's keycode lookups. Layers outside
+// KEYMAP_CACHE_LAYER_MASK are read from flash as before.
+//
+// Enable with KEYMAP_CACHE_ENABLE. It replaces QMK's weak lookup, which the
+// dynamic keymap also replaces, so the two cannot be combined.
+#ifndef KEYMAP_CACHE_LAYER_MASK
+#    define KEYMAP_CACHE_LAYER_MASK 0xFF
+#endif
+
+#ifndef KEYMAP_CACHE_MAX_LAYERS
+#    define KEYMAP_CACHE_MAX_LAYERS 8
+#endif
+
+void keymap_cache_init(void);
+
+// Drop the mirror, e.g. after changing the source keymap; reloaded on next init
+void keymap_cache_invalidate(void);
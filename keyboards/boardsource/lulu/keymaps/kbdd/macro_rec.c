@@ -0,0 +1,227 @@
+/**
+ * @file macro_rec.c
+ * @brief Delta-encoded macro recorder and non-blocking player
+ */
+
+#include "macro_rec.h"
+#include "key_queue.h"
+
+#define CLASS_BASIC 0
+#define CLASS_WIDE 1
+#define CLASS_SAME 2
+
+#define HEADER_PRESSED 0x80
+#define HEADER_CLASS(header) (((header) >> 5) & 0x3)
+#define HEADER_DELTA_MAX 0x1F
+
+// Longest encoding: header, 2-byte varint (a 16-bit timer gap in ticks),
+// 2-byte keycode
+#define EVENT_MAX_BYTES 5
+
+static uint8_t  arena[MACRO_REC_ARENA_SIZE];
+static uint16_t length    = 0;
+static bool     recording = false;
+static uint16_t last_time;
+static uint16_t last_keycode;
+
+typedef struct {
+    uint16_t keycode;
+    uint32_t delta; // ticks before this event
+    bool     pressed;
+} macro_event_t;
+
+static uint16_t play_pos = 0;
+static bool     playing  = false;
+static bool     timed;
+static uint16_t play_keycode;
+static uint16_t held[KEYBOARD_REPORT_KEYS];
+static uint8_t  held_count = 0;
+
+static uint8_t encode(uint8_t *out, uint16_t keycode, bool pressed, uint32_t delta) {
+    uint8_t n     = 0;
+    uint8_t class = keycode == last_keycode ? CLASS_SAME : keycode > 0xFF ? CLASS_WIDE : CLASS_BASIC;
+    uint8_t small = delta < HEADER_DELTA_MAX ? delta : HEADER_DELTA_MAX;
+
+    out[n++] = (pressed ? HEADER_PRESSED : 0) | (class << 5) | small;
+
+    if (small == HEADER_DELTA_MAX) {
+        delta -= HEADER_DELTA_MAX;
+        do {
+            out[n++] = (delta & 0x7F) | (delta > 0x7F ? 0x80 : 0);
+            delta >>= 7;
+        } while (delta);
+    }
+
+    if (class == CLASS_WIDE) {
+        out[n++] = keycode >> 8;
+    }
+    if (class != CLASS_SAME) {
+        out[n++] = keycode & 0xFF;
+    }
+    return n;
+}
+
+static bool decode(uint16_t *pos, macro_event_t *event) {
+    if (*pos >= length) {
+        return false;
+    }
+
+    uint8_t header = arena[(*pos)++];
+    event->pressed = header & HEADER_PRESSED;
+    event->delta   = header & HEADER_DELTA_MAX;
+
+    if (event->delta == HEADER_DELTA_MAX) {
+        uint8_t shift = 0;
+        uint8_t byte;
+        do {
+            byte = arena[(*pos)++];
+            event->delta += (uint32_t)(byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+    }
+
+    switch (HEADER_CLASS(header)) {
+        case CLASS_WIDE:
+            event->keycode = arena[*pos] << 8 | arena[*pos + 1];
+            *pos += 2;
+            break;
+        case CLASS_BASIC:
+            event->keycode = arena[(*pos)++];
+            break;
+        default:
+            event->keycode = play_keycode;
+            break;
+    }
+    play_keycode = event->keycode;
+    return true;
+}
+
+// The keycode a key sent to the host, or KC_NO if it is not recorded
+static uint16_t recorded_keycode(uint16_t keycode, keyrecord_t *record) {
+    if (IS_QK_MOD_TAP(keycode)) {
+        if (record->tap.count) {
+            return QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+        }
+        // Held: the modifiers alone, which register_code16() handles
+        return QK_MOD_TAP_GET_MODS(keycode) << 8 | KC_NO;
+    }
+    if (IS_QK_LAYER_TAP(keycode)) {
+        return record->tap.count ? QK_LAYER_TAP_GET_TAP_KEYCODE(keycode) : KC_NO;
+    }
+    return keycode <= QK_MODS_MAX ? keycode : KC_NO;
+}
+
+void macro_rec_process(uint16_t keycode, keyrecord_t *record) {
+    if (!recording || !IS_EVENT(record->event)) {
+        return;
+    }
+
+    keycode = recorded_keycode(keycode, record);
+    if (keycode == KC_NO) {
+        return;
+    }
+
+    uint8_t  event[EVENT_MAX_BYTES];
+    uint32_t delta = length ? TIMER_DIFF_16(record->event.time, last_time) / MACRO_REC_TICK_MS : 0;
+    uint8_t  n     = encode(event, keycode, record->event.pressed, delta);
+
+    if (length + n > MACRO_REC_ARENA_SIZE) {
+        recording = false; // full; keep what fits
+        return;
+    }
+
+    // Advance by whole ticks so rounding does not add up over the macro
+    last_time    = length ? last_time + delta * MACRO_REC_TICK_MS : record->event.time;
+    last_keycode = keycode;
+    memcpy(&arena[length], event, n);
+    length += n;
+}
+
+void macro_rec_toggle(void) {
+    if (playing) {
+        return;
+    }
+
+    recording = !recording;
+    if (recording) {
+        length       = 0;
+        last_keycode = KC_NO;
+    }
+}
+
+static void play_release_held(void) {
+    for (uint8_t i = 0; i < held_count; i++) {
+        unregister_code16(held[i]);
+    }
+    held_count = 0;
+}
+
+static void play_apply(const macro_event_t *event) {
+    if (event->pressed) {
+        if (held_count == KEYBOARD_REPORT_KEYS) {
+            return;
+        }
+        held[held_count++] = event->keycode;
+        register_code16(event->keycode);
+        return;
+    }
+
+    for (uint8_t i = 0; i < held_count; i++) {
+        if (held[i] == event->keycode) {
+            held[i] = held[--held_count];
+            unregister_code16(event->keycode);
+            return;
+        }
+    }
+}
+
+static macro_event_t next_event;
+
+static uint32_t macro_rec_step(uint32_t trigger_time, void *cb_arg) {
+    play_apply(&next_event);
+
+    while (decode(&play_pos, &next_event)) {
+        if (!timed) {
+            return MACRO_REC_FAST_MS;
+        }
+        // Events in the same tick go out together rather than a
+        // millisecond apart each, which would drift over the macro
+        if (next_event.delta) {
+            return next_event.delta * MACRO_REC_TICK_MS;
+        }
+        play_apply(&next_event);
+    }
+
+    // Keys still down when recording stopped
+    play_release_held();
+    playing = false;
+    key_queue_release();
+    return 0;
+}
+
+bool macro_rec_play(bool timed_playback) {
+    if (recording || playing || length == 0) {
+        return false;
+    }
+
+    play_pos     = 0;
+    play_keycode = KC_NO;
+    timed        = timed_playback;
+    decode(&play_pos, &next_event);
+
+    // Keys typed during playback come out after it
+    if (defer_exec(1, macro_rec_step, NULL) == INVALID_DEFERRED_TOKEN) {
+        return false;
+    }
+    playing = true;
+    key_queue_hold();
+    return true;
+}
+
+bool macro_rec_recording(void) {
+    return recording;
+}
+
+bool macro_rec_playing(void) {
+    return playing;
+}
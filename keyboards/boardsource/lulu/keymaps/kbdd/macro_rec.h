@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include QMK_KEYBOARD_H
+
+// Runtime macro recorder. Events are stored as a delta-encoded byte stream in
+// a fixed arena rather than as keyrecords:
+//
+//   header  [7] pressed  [6:5] keycode class  [4:0] time delta in ticks
+//   varint  delta - 31, only when the header delta is 31
+//   keycode 1 byte (basic), 2 bytes (with mods), none (same as last event)
+//
+// A keyrecord_t is 8 bytes, 128 events per KB. Here a press is usually 2
+// bytes and its release 1; slow typing needs a varint for the gaps.
+// Simulated typing at 40-120 WPM stores 520-630 events per KB (run
+// tests/host/run.sh), so the 256-byte AVR arena holds about 65 keystrokes.
+//
+// Recorded are the keycodes keys resolved to: basic keycodes, keycodes with
+// mods, and mod-taps as their tap keycode or held modifiers. Layer keys,
+// one-shot mods, custom keycodes, tap dances and Unicode keys are not.
+#ifndef MACRO_REC_ARENA_SIZE
+#    ifdef __AVR__
+#        define MACRO_REC_ARENA_SIZE 256
+#    else
+#        define MACRO_REC_ARENA_SIZE 1024
+#    endif
+#endif
+
+// Delta resolution; a tick of 4 ms keeps typical gaps in the header byte
+#ifndef MACRO_REC_TICK_MS
+#    define MACRO_REC_TICK_MS 4
+#endif
+
+// Gap between events when not reproducing timing
+#ifndef MACRO_REC_FAST_MS
+#    define MACRO_REC_FAST_MS 2
+#endif
+
+// Starts recording over the previous macro, or stops and keeps it
+void macro_rec_toggle(void);
+
+// Plays the macro without blocking, at recorded speed if timed. Returns false
+// while recording or already playing.
+bool macro_rec_play(bool timed);
+
+bool macro_rec_recording(void);
+bool macro_rec_playing(void);
+
+// From process_record_user()
+void macro_rec_process(uint16_t keycode, keyrecord_t *record);
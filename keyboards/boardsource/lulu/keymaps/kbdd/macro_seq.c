@@ -0,0 +1,125 @@
+/**
+ * @file macro_seq.c
+ * @brief Step-sequenced macros on deferred execution
+ *
+ * A macro runs on one deferred executor from start to end, text steps
+ * included, so it is claimed up front: a macro either types all of its steps
+ * or, if no executor is free, none of them.
+ */
+
+#include "macro_seq.h"
+#include "key_queue.h"
+#include "packed_string.h"
+
+// How often to retry a text step while another string is being typed
+#define MACRO_SEQ_POLL_MS 2
+
+static const macro_step_t *macro_steps  = NULL;
+static uint8_t             macro_count  = 0;
+static uint8_t             macro_next   = 0;
+static uint16_t            macro_wait   = 0; // delay owed after a text step
+static bool                macro_typing = false;
+
+static const macro_step_t *waiting_steps = NULL;
+static uint8_t             waiting_count = 0;
+
+static void macro_seq_finish(void) {
+    macro_steps = NULL;
+    macro_wait  = 0;
+    key_queue_release();
+}
+
+static uint32_t macro_seq_step(uint32_t trigger_time, void *cb_arg) {
+    if (macro_typing) {
+        uint32_t delay_ms = packed_string_poll();
+        if (delay_ms) {
+            return delay_ms;
+        }
+        macro_typing = false;
+
+        // The delay runs from when the text has finished
+        if (macro_wait && macro_next < macro_count) {
+            delay_ms   = macro_wait;
+            macro_wait = 0;
+            return delay_ms;
+        }
+    }
+
+    while (macro_next < macro_count) {
+        const macro_step_t *step     = &macro_steps[macro_next];
+        uint16_t            delay_ms = pgm_read_word(&step->delay_ms);
+        const char         *text     = pgm_read_ptr(&step->text);
+
+        if (text) {
+            // Typed from this executor, one report per call
+            if (!packed_string_start(text)) {
+                return MACRO_SEQ_POLL_MS;
+            }
+            macro_next++;
+            macro_typing = true;
+            macro_wait   = delay_ms;
+            return macro_seq_step(trigger_time, cb_arg);
+        }
+
+        macro_next++;
+        tap_code16(pgm_read_word(&step->keycode));
+        if (delay_ms && macro_next < macro_count) {
+            return delay_ms;
+        }
+    }
+
+    macro_seq_finish();
+    return 0;
+}
+
+bool macro_seq_start(const macro_step_t *steps, uint8_t count) {
+    if (macro_steps != NULL) {
+        return false;
+    }
+
+    // Claim the executor before anything is typed
+    deferred_token token = defer_exec(MACRO_SEQ_POLL_MS, macro_seq_step, NULL);
+    if (token == INVALID_DEFERRED_TOKEN) {
+        return false;
+    }
+
+    macro_steps  = steps;
+    macro_count  = count;
+    macro_next   = 0;
+    macro_wait   = 0;
+    macro_typing = false;
+
+    // First step runs now; the executor only takes over for the waits
+    key_queue_hold();
+    uint32_t delay_ms = macro_seq_step(0, NULL);
+    if (delay_ms) {
+        extend_deferred_exec(token, delay_ms);
+    } else {
+        cancel_deferred_exec(token);
+    }
+    return true;
+}
+
+bool macro_seq_start_soon(const macro_step_t *steps, uint8_t count) {
+    if (waiting_steps != NULL) {
+        return false;
+    }
+    if (macro_seq_start(steps, count)) {
+        return true;
+    }
+
+    waiting_steps = steps;
+    waiting_count = count;
+    key_queue_hold();
+    return true;
+}
+
+void macro_seq_task(void) {
+    if (waiting_steps == NULL || !macro_seq_start(waiting_steps, waiting_count)) {
+        return;
+    }
+
+    // The macro holds the queue now
+    waiting_steps = NULL;
+    key_queue_release();
+}
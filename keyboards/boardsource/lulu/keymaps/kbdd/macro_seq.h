@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include QMK_KEYBOARD_H
+
+// Multi-step macros that wait between steps without blocking the main loop.
+// Each step taps a 16-bit keycode, or types a PROGMEM string through the
+// packed string sender, and then waits delay_ms before the next; steps with
+// no delay run back to back. Keys typed meanwhile are held by the key queue
+// until the macro finishes.
+typedef struct {
+    uint16_t    keycode;
+    uint16_t    delay_ms;
+    const char *text; // PROGMEM, or NULL to tap keycode
+} macro_step_t;
+
+#define MACRO_SEQ(name, ...) static const macro_step_t PROGMEM name[] = {__VA_ARGS__}
+#define MACRO_TEXT(progmem_string, delay) {KC_NO, (delay), (progmem_string)}
+
+// Starts the macro; returns false, having typed nothing, if one is already
+// running or no deferred executor is free.
+bool macro_seq_start(const macro_step_t *steps, uint8_t count);
+
+#define MACRO_SEQ_START(name) macro_seq_start(name, ARRAY_SIZE(name))
+
+// Starts the macro, or if it cannot start yet keeps it waiting and holds the
+// key queue until macro_seq_task() does. One macro waits at a time; returns
+// false, having done nothing, if another already is.
+bool macro_seq_start_soon(const macro_step_t *steps, uint8_t count);
+
+#define MACRO_SEQ_START_SOON(name) macro_seq_start_soon(name, ARRAY_SIZE(name))
+
+// From housekeeping: retries the waiting macro
+void macro_seq_task(void);
@@ -0,0 +1,109 @@
+/**
+ * @file packed_string.c
+ * @brief Report-packing, non-blocking string sender
+ *
+ * SEND_STRING() costs two reports per character, four for shifted ones.
+ * Here a run of n distinct keys costs n press reports plus one release, and
+ * a modifier change one more. One report goes out per USB poll interval.
+ */
+
+#include "packed_string.h"
+#include "key_queue.h"
+
+#ifndef PACKED_STRING_INTERVAL_MS
+#    define PACKED_STRING_INTERVAL_MS 1
+#endif
+
+static const char *next_char = NULL;
+static uint8_t     held[KEYBOARD_REPORT_KEYS];
+static uint8_t     held_count = 0;
+
+static bool ascii_bit(const uint8_t *table, uint8_t c) {
+    return (pgm_read_byte(&table[c / 8]) >> (c % 8)) & 1;
+}
+
+static bool is_held(uint8_t keycode) {
+    for (uint8_t i = 0; i < held_count; i++) {
+        if (held[i] == keycode) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void release_held(void) {
+    for (uint8_t i = 0; i < held_count; i++) {
+        del_key(held[i]);
+    }
+    held_count = 0;
+}
+
+// One report per call
+uint32_t packed_string_poll(void) {
+    uint8_t c = next_char ? pgm_read_byte(next_char) : 0;
+
+    // Characters outside the tables are skipped, as SEND_STRING() does
+    while (c >= 128) {
+        c = pgm_read_byte(++next_char);
+    }
+
+    if (c == 0) {
+        if (held_count == 0 && get_weak_mods() == 0) {
+            next_char = NULL;
+            key_queue_release();
+            return 0;
+        }
+        release_held();
+        clear_weak_mods();
+        send_keyboard_report();
+        return PACKED_STRING_INTERVAL_MS;
+    }
+
+    uint8_t keycode = pgm_read_byte(&ascii_to_keycode_lut[c]);
+    uint8_t mods    = ascii_bit(ascii_to_shift_lut, c) ? MOD_BIT(KC_LSFT) : 0;
+
+    if (held_count && (is_held(keycode) || mods != get_weak_mods() || held_count == KEYBOARD_REPORT_KEYS)) {
+        release_held();
+    } else if (mods != get_weak_mods()) {
+        // Modifiers change in a report of their own, never with a key-down
+        clear_weak_mods();
+        add_weak_mods(mods);
+    } else {
+        add_key(keycode);
+        held[held_count++] = keycode;
+        next_char++;
+    }
+
+    send_keyboard_report();
+    return PACKED_STRING_INTERVAL_MS;
+}
+
+static uint32_t packed_string_step(uint32_t trigger_time, void *cb_arg) {
+    return packed_string_poll();
+}
+
+bool packed_string_busy(void) {
+    return next_char != NULL;
+}
+
+bool packed_string_start(const char *str) {
+    if (packed_string_busy()) {
+        return false;
+    }
+
+    next_char = str;
+    key_queue_hold();
+    return true;
+}
+
+bool packed_string_send(const char *str) {
+    if (packed_string_busy()) {
+        return false;
+    }
+
+    // Nothing is typed unless the whole string can be
+    if (defer_exec(PACKED_STRING_INTERVAL_MS, packed_string_step, NULL) == INVALID_DEFERRED_TOKEN) {
+        return false;
+    }
+    return packed_string_start(str);
+}
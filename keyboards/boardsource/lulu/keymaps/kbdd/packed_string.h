@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include QMK_KEYBOARD_H
+
+// Non-blocking string sender that holds keys down across reports instead of
+// tapping them one by one. Each report presses exactly one more key, so the
+// host still sees key-downs in string order, and a whole run of distinct keys
+// is released in a single report. A run ends at a repeated key, a modifier
+// change or a full report.
+//
+// Strings live in PROGMEM and use the same ASCII tables as SEND_STRING().
+
+// Starts sending; returns false, having typed nothing, if a string is already
+// in flight or no deferred executor is free.
+bool packed_string_send(const char *str);
+
+bool packed_string_busy(void);
+
+// For a caller that already runs on a deferred executor: start a string, then
+// call packed_string_poll() after the delay it returns until it returns 0.
+bool     packed_string_start(const char *str);
+uint32_t packed_string_poll(void);
+
+#define PACKED_STRING(string) packed_string_send(PSTR(string))
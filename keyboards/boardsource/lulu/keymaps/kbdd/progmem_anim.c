@@ -1,3 +1,5 @@
+// Source frames for progmem_atlas.c; run build_atlas.py after editing.
+
 #include <sys/types.h>
 #include QMK_KEYBOARD_H
 #include "progmem_anim.h"
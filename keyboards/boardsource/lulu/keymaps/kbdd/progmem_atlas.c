@@ -0,0 +1,763 @@
+// Generated by build_atlas.py from progmem_anim.c, do not edit.
+
+#include QMK_KEYBOARD_H
+#include "progmem_atlas.h"
+#include "hot_path.h"
+
+// Drawn every tick, in SRAM on the RP2040
+const uint8_t HOT_DATA(asset_atlas)[] = {
+    // super_0 @ 0 (78 bytes)
+    0x80, 0x60, 0x18, 0x06, 0x01, 0x5d, 0x55, 0x55, 0x55, 0x75, 0x01, 0x7d, 0x41, 0x41, 0x41, 0x7d,
+    0x01, 0x7d, 0x15, 0x15, 0x15, 0x1d, 0x01, 0x7d, 0x55, 0x55, 0x55, 0x45, 0x01, 0x7d, 0x15, 0x15,
+    0x35, 0x5d, 0x01, 0xc1, 0x31, 0x0d, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    // alt_0 @ 78 (50 bytes)
+    0x80, 0x60, 0x18, 0x06, 0x01, 0x01, 0x7d, 0x15, 0x15, 0x15, 0x7d, 0x01, 0x7d, 0x41, 0x41, 0x41,
+    0x41, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01,
+    // shift_0 @ 128 (66 bytes)
+    0xff, 0x01, 0x5d, 0x55, 0x55, 0x55, 0x75, 0x01, 0x7d, 0x11, 0x11, 0x11, 0x7d, 0x01, 0x7d, 0x01,
+    0x7d, 0x15, 0x15, 0x15, 0x05, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05, 0x01, 0x01, 0x06, 0x18, 0x60,
+    0x80, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01,
+    // ctrl_0 @ 194 (66 bytes)
+    0x03, 0x0d, 0x31, 0xc1, 0x01, 0x7d, 0x45, 0x45, 0x45, 0x45, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05,
+    0x01, 0x7d, 0x15, 0x15, 0x35, 0x5d, 0x01, 0x7d, 0x41, 0x41, 0x41, 0x41, 0x01, 0x06, 0x18, 0x60,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01,
+    // super_1 @ 260 (78 bytes)
+    0x80, 0x60, 0x18, 0x0e, 0x0f, 0x53, 0x5b, 0x5b, 0x5b, 0x7b, 0x0f, 0x73, 0x4f, 0x4f, 0x4f, 0x73,
+    0x0f, 0x73, 0x1b, 0x1b, 0x1b, 0x13, 0x0f, 0x73, 0x5b, 0x5b, 0x5b, 0x4b, 0x0f, 0x73, 0x1b, 0x1b,
+    0x3b, 0x53, 0x0f, 0xcf, 0x3f, 0x0f, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    // alt_1 @ 338 (50 bytes)
+    0x80, 0x60, 0x18, 0x0e, 0x0f, 0x0f, 0x73, 0x1b, 0x1b, 0x1b, 0x73, 0x0f, 0x73, 0x4f, 0x4f, 0x4f,
+    0x4f, 0x0f, 0x0b, 0x0b, 0x73, 0x0b, 0x0b, 0x0f, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01,
+    // shift_1 @ 388 (66 bytes)
+    0xff, 0x0f, 0x53, 0x5b, 0x5b, 0x5b, 0x7b, 0x0f, 0x73, 0x1f, 0x1f, 0x1f, 0x73, 0x0f, 0x73, 0x0f,
+    0x73, 0x1b, 0x1b, 0x1b, 0x0b, 0x0f, 0x0b, 0x0b, 0x73, 0x0b, 0x0b, 0x0f, 0x0f, 0x0e, 0x18, 0x60,
+    0x80, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01,
+    // ctrl_1 @ 454 (66 bytes)
+    0x03, 0x0f, 0x3f, 0xcf, 0x0f, 0x73, 0x4b, 0x4b, 0x4b, 0x4b, 0x0f, 0x0b, 0x0b, 0x73, 0x0b, 0x0b,
+    0x0f, 0x73, 0x1b, 0x1b, 0x3b, 0x53, 0x0f, 0x73, 0x4f, 0x4f, 0x4f, 0x4f, 0x0f, 0x0e, 0x18, 0x60,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01,
+    // super_2 @ 520 (78 bytes)
+    0x80, 0x60, 0x38, 0x3e, 0x3f, 0x63, 0x6b, 0x6b, 0x6b, 0x4b, 0x3f, 0x43, 0x7f, 0x7f, 0x7f, 0x43,
+    0x3f, 0x43, 0x2b, 0x2b, 0x2b, 0x23, 0x3f, 0x43, 0x6b, 0x6b, 0x6b, 0x7b, 0x3f, 0x43, 0x2b, 0x2b,
+    0x0b, 0x63, 0x3f, 0xff, 0x3f, 0x0f, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    // alt_2 @ 598 (50 bytes)
+    0x80, 0x60, 0x38, 0x3e, 0x3f, 0x3f, 0x43, 0x2b, 0x2b, 0x2b, 0x43, 0x3f, 0x43, 0x7f, 0x7f, 0x7f,
+    0x7f, 0x3f, 0x3b, 0x3b, 0x43, 0x3b, 0x3b, 0x3f, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01,
+    // shift_2 @ 648 (66 bytes)
+    0xff, 0x3f, 0x63, 0x6b, 0x6b, 0x6b, 0x4b, 0x3f, 0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x3f, 0x43, 0x3f,
+    0x43, 0x2b, 0x2b, 0x2b, 0x3b, 0x3f, 0x3b, 0x3b, 0x43, 0x3b, 0x3b, 0x3f, 0x3f, 0x3e, 0x38, 0x60,
+    0x80, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01,
+    // ctrl_2 @ 714 (66 bytes)
+    0x03, 0x0f, 0x3f, 0xff, 0x3f, 0x43, 0x7b, 0x7b, 0x7b, 0x7b, 0x3f, 0x3b, 0x3b, 0x43, 0x3b, 0x3b,
+    0x3f, 0x43, 0x2b, 0x2b, 0x0b, 0x63, 0x3f, 0x43, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0x3e, 0x38, 0x60,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01,
+    // super_3 @ 780 (78 bytes)
+    0x80, 0xe0, 0xf8, 0xfe, 0xff, 0xa3, 0xab, 0xab, 0xab, 0x8b, 0xff, 0x83, 0xbf, 0xbf, 0xbf, 0x83,
+    0xff, 0x83, 0xeb, 0xeb, 0xeb, 0xe3, 0xff, 0x83, 0xab, 0xab, 0xab, 0xbb, 0xff, 0x83, 0xeb, 0xeb,
+    0xcb, 0xa3, 0xff, 0xff, 0x3f, 0x0f, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    // alt_3 @ 858 (50 bytes)
+    0x80, 0xe0, 0xf8, 0xfe, 0xff, 0xff, 0x83, 0xeb, 0xeb, 0xeb, 0x83, 0xff, 0x83, 0xbf, 0xbf, 0xbf,
+    0xbf, 0xff, 0xfb, 0xfb, 0x83, 0xfb, 0xfb, 0xff, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01,
+    // shift_3 @ 908 (66 bytes)
+    0xff, 0xff, 0xa3, 0xab, 0xab, 0xab, 0x8b, 0xff, 0x83, 0xef, 0xef, 0xef, 0x83, 0xff, 0x83, 0xff,
+    0x83, 0xeb, 0xeb, 0xeb, 0xfb, 0xff, 0xfb, 0xfb, 0x83, 0xfb, 0xfb, 0xff, 0xff, 0xfe, 0xf8, 0xe0,
+    0x80, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01,
+    // ctrl_3 @ 974 (66 bytes)
+    0x03, 0x0f, 0x3f, 0xff, 0xff, 0x83, 0xbb, 0xbb, 0xbb, 0xbb, 0xff, 0xfb, 0xfb, 0x83, 0xfb, 0xfb,
+    0xff, 0x83, 0xeb, 0xeb, 0xcb, 0xa3, 0xff, 0x83, 0xbf, 0xbf, 0xbf, 0xbf, 0xff, 0xfe, 0xf8, 0xe0,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01,
+    // qwerty_0 @ 1040 (48 bytes)
+    0x00, 0x3e, 0x22, 0x2a, 0x12, 0x2e, 0x00, 0x3e, 0x20, 0x18, 0x20, 0x3e, 0x00, 0x3e, 0x2a, 0x2a,
+    0x2a, 0x22, 0x00, 0x3e, 0x0a, 0x0a, 0x1a, 0x2e, 0x00, 0x02, 0x02, 0x3e, 0x02, 0x02, 0x00, 0x02,
+    0x04, 0x38, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // gaming_0 @ 1088 (48 bytes)
+    0x00, 0x3e, 0x22, 0x22, 0x2a, 0x3a, 0x00, 0x3e, 0x0a, 0x0a, 0x0a, 0x3e, 0x00, 0x3e, 0x02, 0x0c,
+    0x02, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x04, 0x08, 0x10, 0x3e, 0x00, 0x3e, 0x22, 0x22, 0x2a, 0x3a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // unicode_0 @ 1136 (48 bytes)
+    0x00, 0x3e, 0x20, 0x20, 0x20, 0x3e, 0x00, 0x3e, 0x04, 0x08, 0x10, 0x3e, 0x00, 0x3e, 0x00, 0x3e,
+    0x22, 0x22, 0x22, 0x22, 0x00, 0x3e, 0x22, 0x22, 0x22, 0x3e, 0x00, 0x3e, 0x22, 0x22, 0x22, 0x1c,
+    0x00, 0x3e, 0x2a, 0x2a, 0x2a, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // symbol_0 @ 1184 (48 bytes)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x2a, 0x2a, 0x2a,
+    0x3a, 0x00, 0x02, 0x04, 0x38, 0x04, 0x02, 0x00, 0x3e, 0x02, 0x0c, 0x02, 0x3e, 0x00, 0x3e, 0x2a,
+    0x2a, 0x2a, 0x14, 0x00, 0x3e, 0x22, 0x22, 0x22, 0x3e, 0x00, 0x3e, 0x20, 0x20, 0x20, 0x20, 0x00,
+    // navigation_0 @ 1232 (64 bytes)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x04, 0x08, 0x10,
+    0x3e, 0x00, 0x3e, 0x0a, 0x0a, 0x0a, 0x3e, 0x00, 0x0e, 0x10, 0x20, 0x10, 0x0e, 0x00, 0x3e, 0x00,
+    0x3e, 0x22, 0x22, 0x2a, 0x3a, 0x00, 0x3e, 0x0a, 0x0a, 0x0a, 0x3e, 0x00, 0x02, 0x02, 0x3e, 0x02,
+    0x02, 0x00, 0x3e, 0x00, 0x3e, 0x22, 0x22, 0x22, 0x3e, 0x00, 0x3e, 0x04, 0x08, 0x10, 0x3e, 0x00,
+    // function_0 @ 1296 (56 bytes)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x0a, 0x0a, 0x0a,
+    0x02, 0x00, 0x3e, 0x20, 0x20, 0x20, 0x3e, 0x00, 0x3e, 0x04, 0x08, 0x10, 0x3e, 0x00, 0x3e, 0x22,
+    0x22, 0x22, 0x22, 0x00, 0x02, 0x02, 0x3e, 0x02, 0x02, 0x00, 0x3e, 0x00, 0x3e, 0x22, 0x22, 0x22,
+    0x3e, 0x00, 0x3e, 0x04, 0x08, 0x10, 0x3e, 0x00,
+    // qwerty_1 @ 1352 (48 bytes)
+    0x7f, 0x41, 0x5d, 0x55, 0x6d, 0x51, 0x7f, 0x41, 0x5f, 0x67, 0x5f, 0x41, 0x7f, 0x41, 0x55, 0x55,
+    0x55, 0x5d, 0x7f, 0x41, 0x75, 0x75, 0x65, 0x51, 0x00, 0x02, 0x02, 0x3e, 0x02, 0x02, 0x00, 0x02,
+    0x04, 0x38, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // gaming_1 @ 1400 (48 bytes)
+    0x7f, 0x41, 0x5d, 0x5d, 0x55, 0x45, 0x7f, 0x41, 0x75, 0x75, 0x75, 0x41, 0x7f, 0x41, 0x7d, 0x73,
+    0x7d, 0x41, 0x7f, 0x41, 0x7f, 0x41, 0x7b, 0x77, 0x10, 0x3e, 0x00, 0x3e, 0x22, 0x22, 0x2a, 0x3a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // unicode_1 @ 1448 (48 bytes)
+    0x7f, 0x41, 0x5f, 0x5f, 0x5f, 0x41, 0x7f, 0x41, 0x7b, 0x77, 0x6f, 0x41, 0x7f, 0x41, 0x7f, 0x41,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x7f, 0x41, 0x5d, 0x5d, 0x22, 0x3e, 0x00, 0x3e, 0x22, 0x22, 0x22, 0x1c,
+    0x00, 0x3e, 0x2a, 0x2a, 0x2a, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // symbol_1 @ 1496 (48 bytes)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x2a, 0x2a, 0x2a,
+    0x3a, 0x00, 0x02, 0x04, 0x38, 0x04, 0x02, 0x00, 0x41, 0x7d, 0x73, 0x7d, 0x41, 0x7f, 0x41, 0x55,
+    0x55, 0x55, 0x6b, 0x7f, 0x41, 0x5d, 0x5d, 0x5d, 0x41, 0x7f, 0x41, 0x5f, 0x5f, 0x5f, 0x5f, 0x7f,
+    // navigation_1 @ 1544 (64 bytes)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x04, 0x08, 0x10,
+    0x3e, 0x00, 0x3e, 0x0a, 0x0a, 0x0a, 0x3e, 0x00, 0x0e, 0x10, 0x20, 0x10, 0x0e, 0x00, 0x3e, 0x00,
+    0x41, 0x5d, 0x5d, 0x55, 0x45, 0x7f, 0x41, 0x75, 0x75, 0x75, 0x41, 0x7f, 0x7d, 0x7d, 0x41, 0x7d,
+    0x7d, 0x7f, 0x41, 0x7f, 0x41, 0x5d, 0x5d, 0x5d, 0x41, 0x7f, 0x41, 0x7b, 0x77, 0x6f, 0x41, 0x7f,
+    // function_1 @ 1608 (56 bytes)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x0a, 0x0a, 0x0a,
+    0x02, 0x00, 0x3e, 0x20, 0x20, 0x20, 0x3e, 0x00, 0x3e, 0x04, 0x08, 0x10, 0x41, 0x7f, 0x41, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x7f, 0x7d, 0x7d, 0x41, 0x7d, 0x7d, 0x7f, 0x41, 0x7f, 0x41, 0x5d, 0x5d, 0x5d,
+    0x41, 0x7f, 0x41, 0x7b, 0x77, 0x6f, 0x41, 0x7f,
+    // qwerty_2 @ 1664 (48 bytes)
+    0x7f, 0x41, 0x5d, 0x55, 0x6d, 0x51, 0x7f, 0x41, 0x5f, 0x67, 0x5f, 0x41, 0x7f, 0x41, 0x55, 0x55,
+    0x55, 0x5d, 0x7f, 0x41, 0x75, 0x75, 0x65, 0x51, 0x7f, 0x7d, 0x7d, 0x41, 0x7d, 0x7d, 0x7f, 0x7d,
+    0x7b, 0x47, 0x7b, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // gaming_2 @ 1712 (48 bytes)
+    0x7f, 0x41, 0x5d, 0x5d, 0x55, 0x45, 0x7f, 0x41, 0x75, 0x75, 0x75, 0x41, 0x7f, 0x41, 0x7d, 0x73,
+    0x7d, 0x41, 0x7f, 0x41, 0x7f, 0x41, 0x7b, 0x77, 0x6f, 0x41, 0x7f, 0x41, 0x5d, 0x5d, 0x55, 0x45,
+    0x7f, 0x3f, 0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // unicode_2 @ 1760 (48 bytes)
+    0x7f, 0x41, 0x5f, 0x5f, 0x5f, 0x41, 0x7f, 0x41, 0x7b, 0x77, 0x6f, 0x41, 0x7f, 0x41, 0x7f, 0x41,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x7f, 0x41, 0x5d, 0x5d, 0x5d, 0x41, 0x7f, 0x41, 0x5d, 0x5d, 0x5d, 0x63,
+    0x7f, 0x41, 0x55, 0x55, 0x2a, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // symbol_2 @ 1808 (48 bytes)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x55, 0x55, 0x55,
+    0x45, 0x7f, 0x7d, 0x7b, 0x47, 0x7b, 0x7d, 0x7f, 0x41, 0x7d, 0x73, 0x7d, 0x41, 0x7f, 0x41, 0x55,
+    0x55, 0x55, 0x6b, 0x7f, 0x41, 0x5d, 0x5d, 0x5d, 0x41, 0x7f, 0x41, 0x5f, 0x5f, 0x5f, 0x5f, 0x7f,
+    // navigation_2 @ 1856 (64 bytes)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x04, 0x08, 0x10,
+    0x41, 0x7f, 0x41, 0x75, 0x75, 0x75, 0x41, 0x7f, 0x71, 0x6f, 0x5f, 0x6f, 0x71, 0x7f, 0x41, 0x7f,
+    0x41, 0x5d, 0x5d, 0x55, 0x45, 0x7f, 0x41, 0x75, 0x75, 0x75, 0x41, 0x7f, 0x7d, 0x7d, 0x41, 0x7d,
+    0x7d, 0x7f, 0x41, 0x7f, 0x41, 0x5d, 0x5d, 0x5d, 0x41, 0x7f, 0x41, 0x7b, 0x77, 0x6f, 0x41, 0x7f,
+    // function_2 @ 1920 (56 bytes)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x0a, 0x75, 0x75,
+    0x7d, 0x7f, 0x41, 0x5f, 0x5f, 0x5f, 0x41, 0x7f, 0x41, 0x7b, 0x77, 0x6f, 0x41, 0x7f, 0x41, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x7f, 0x7d, 0x7d, 0x41, 0x7d, 0x7d, 0x7f, 0x41, 0x7f, 0x41, 0x5d, 0x5d, 0x5d,
+    0x41, 0x7f, 0x41, 0x7b, 0x77, 0x6f, 0x41, 0x7f,
+    // qwerty_3 @ 1976 (48 bytes)
+    0x7f, 0x41, 0x5d, 0x55, 0x6d, 0x51, 0x7f, 0x41, 0x5f, 0x67, 0x5f, 0x41, 0x7f, 0x41, 0x55, 0x55,
+    0x55, 0x5d, 0x7f, 0x41, 0x75, 0x75, 0x65, 0x51, 0x7f, 0x7d, 0x7d, 0x41, 0x7d, 0x7d, 0x7f, 0x7d,
+    0x7b, 0x47, 0x7b, 0x7d, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // gaming_3 @ 2024 (48 bytes)
+    0x7f, 0x41, 0x5d, 0x5d, 0x55, 0x45, 0x7f, 0x41, 0x75, 0x75, 0x75, 0x41, 0x7f, 0x41, 0x7d, 0x73,
+    0x7d, 0x41, 0x7f, 0x41, 0x7f, 0x41, 0x7b, 0x77, 0x6f, 0x41, 0x7f, 0x41, 0x5d, 0x5d, 0x55, 0x45,
+    0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // unicode_3 @ 2072 (48 bytes)
+    0x7f, 0x41, 0x5f, 0x5f, 0x5f, 0x41, 0x7f, 0x41, 0x7b, 0x77, 0x6f, 0x41, 0x7f, 0x41, 0x7f, 0x41,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x7f, 0x41, 0x5d, 0x5d, 0x5d, 0x41, 0x7f, 0x41, 0x5d, 0x5d, 0x5d, 0x63,
+    0x7f, 0x41, 0x55, 0x55, 0x55, 0x5d, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00,
+    // symbol_3 @ 2120 (48 bytes)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x60, 0x70, 0x78, 0x7c, 0x7e, 0x7f, 0x51, 0x55, 0x55, 0x55,
+    0x45, 0x7f, 0x7d, 0x7b, 0x47, 0x7b, 0x7d, 0x7f, 0x41, 0x7d, 0x73, 0x7d, 0x41, 0x7f, 0x41, 0x55,
+    0x55, 0x55, 0x6b, 0x7f, 0x41, 0x5d, 0x5d, 0x5d, 0x41, 0x7f, 0x41, 0x5f, 0x5f, 0x5f, 0x5f, 0x7f,
+    // navigation_3 @ 2168 (64 bytes)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x60, 0x70, 0x78, 0x7c, 0x7e, 0x7f, 0x41, 0x7b, 0x77, 0x6f,
+    0x41, 0x7f, 0x41, 0x75, 0x75, 0x75, 0x41, 0x7f, 0x71, 0x6f, 0x5f, 0x6f, 0x71, 0x7f, 0x41, 0x7f,
+    0x41, 0x5d, 0x5d, 0x55, 0x45, 0x7f, 0x41, 0x75, 0x75, 0x75, 0x41, 0x7f, 0x7d, 0x7d, 0x41, 0x7d,
+    0x7d, 0x7f, 0x41, 0x7f, 0x41, 0x5d, 0x5d, 0x5d, 0x41, 0x7f, 0x41, 0x7b, 0x77, 0x6f, 0x41, 0x7f,
+    // function_3 @ 2232 (56 bytes)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x60, 0x70, 0x78, 0x7c, 0x7e, 0x7f, 0x41, 0x75, 0x75, 0x75,
+    0x7d, 0x7f, 0x41, 0x5f, 0x5f, 0x5f, 0x41, 0x7f, 0x41, 0x7b, 0x77, 0x6f, 0x41, 0x7f, 0x41, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x7f, 0x7d, 0x7d, 0x41, 0x7d, 0x7d, 0x7f, 0x41, 0x7f, 0x41, 0x5d, 0x5d, 0x5d,
+    0x41, 0x7f, 0x41, 0x7b, 0x77, 0x6f, 0x41, 0x7f,
+    // digit_0 @ 2288 (5 bytes)
+    0xff, 0x81, 0x81, 0x81, 0xff,
+    // digit_1 @ 2293 (5 bytes)
+    0x80, 0x82, 0xff, 0x80, 0x80,
+    // digit_2 @ 2298 (5 bytes)
+    0xc2, 0xa1, 0x91, 0x89, 0x86,
+    // digit_3 @ 2303 (5 bytes)
+    0x42, 0x89, 0x89, 0x89, 0x76,
+    // digit_4 @ 2308 (5 bytes)
+    0x0f, 0x08, 0x08, 0x08, 0xff,
+    // digit_5 @ 2313 (5 bytes)
+    0x4f, 0x89, 0x89, 0x89, 0x71,
+    // digit_6 @ 2318 (5 bytes)
+    0x7e, 0x89, 0x89, 0x89, 0x72,
+    // digit_7 @ 2323 (5 bytes)
+    0x01, 0x01, 0xf1, 0x09, 0x07,
+    // digit_8 @ 2328 (5 bytes)
+    0x76, 0x89, 0x89, 0x89, 0x76,
+    // digit_9 @ 2333 (5 bytes)
+    0x46, 0x89, 0x89, 0x89, 0x7e,
+    // colon @ 2338 (1 bytes)
+    0x24,
+    // am @ 2339 (5 bytes)
+    0xf8, 0x28, 0x28, 0x28, 0xf8,
+    // pm @ 2344 (5 bytes)
+    0xf8, 0x28, 0x28, 0x28, 0x38,
+};
+
+// Boot animation and other cold frames
+const uint8_t PROGMEM asset_atlas_cold[] = {
+    // boot_0 @ 0 (512 bytes)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // boot_1 @ 512 (512 bytes)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // boot_2 @ 1024 (512 bytes)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x04, 0xf4, 0x14, 0x54, 0x94, 0x74, 0x04, 0xf4, 0x04, 0xc4, 0x04, 0xf4, 0x04, 0xf4, 0x54,
+    0x54, 0x54, 0x14, 0x04, 0xf4, 0x54, 0x54, 0xd4, 0x74, 0x04, 0x14, 0x14, 0xf4, 0x14, 0x14, 0x04,
+    0x14, 0x24, 0xc4, 0x24, 0x14, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // boot_3 @ 1536 (512 bytes)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x04, 0xf4, 0x14, 0x54, 0x94, 0x74, 0x04, 0xf4, 0x04, 0xc4, 0x04, 0xf4, 0x04, 0xf4, 0x54,
+    0x54, 0x54, 0x14, 0x04, 0xf4, 0x54, 0x54, 0xd4, 0x74, 0x04, 0x14, 0x14, 0xf4, 0x14, 0x14, 0x04,
+    0x14, 0x24, 0xc4, 0x24, 0x14, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x7d, 0x45, 0x45, 0x54, 0x75, 0x00, 0x7d, 0x15, 0x14, 0x15, 0x7d, 0x00, 0x7d, 0x05,
+    0x19, 0x05, 0x7d, 0x00, 0x7d, 0x00, 0x7c, 0x08, 0x11, 0x20, 0x7c, 0x00, 0x7d, 0x44, 0x44, 0x54,
+    0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // boot_4 @ 2048 (512 bytes)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x04, 0xf4, 0x14, 0x54, 0x94, 0x74, 0x04, 0xf4, 0x04, 0xc4, 0x04, 0xf4, 0x04, 0xf4, 0x54,
+    0x54, 0x54, 0x14, 0x04, 0xf4, 0x54, 0x54, 0xd4, 0x74, 0x04, 0x14, 0x14, 0xf4, 0x14, 0x14, 0x04,
+    0x14, 0x24, 0xc4, 0x24, 0x14, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x7d, 0x45, 0x45, 0x54, 0x75, 0x00, 0x7d, 0x15, 0x14, 0x15, 0x7d, 0x00, 0x7d, 0x05,
+    0x19, 0x05, 0x7d, 0x00, 0x7d, 0x00, 0x7c, 0x08, 0x11, 0x20, 0x7c, 0x00, 0x7d, 0x44, 0x44, 0x54,
+    0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7f, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f, 0x40,
+    0x5f, 0x51, 0x51, 0x51, 0x51, 0x40, 0x5f, 0x51, 0x51, 0x51, 0x5f, 0x40, 0x5f, 0x51, 0x51, 0x51,
+    0x4e, 0x40, 0x5f, 0x55, 0x55, 0x55, 0x51, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // boot_5 @ 2560 (512 bytes)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x04, 0xf4, 0x14, 0x54, 0x94, 0x74, 0x04, 0xf4, 0x04, 0xc4, 0x04, 0xf4, 0x04, 0xf4, 0x54,
+    0x54, 0x54, 0x14, 0x04, 0xf4, 0x54, 0x54, 0xd4, 0x74, 0x04, 0x14, 0x14, 0xf4, 0x14, 0x14, 0x04,
+    0x14, 0x24, 0xc4, 0x24, 0x14, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x74, 0x54, 0x54, 0x54, 0xd4, 0x04, 0x14, 0x24, 0xc4, 0x24, 0x14,
+    0x04, 0xf4, 0x14, 0x64, 0x14, 0xf4, 0x04, 0xf4, 0x54, 0x54, 0x54, 0xa4, 0x04, 0xf4, 0x14, 0x14,
+    0x14, 0xf4, 0x04, 0xf4, 0x04, 0x04, 0x04, 0x04, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x7d, 0x45, 0x45, 0x54, 0x75, 0x00, 0x7d, 0x15, 0x14, 0x15, 0x7d, 0x00, 0x7d, 0x05,
+    0x19, 0x05, 0x7d, 0x00, 0x7d, 0x00, 0x7c, 0x08, 0x11, 0x20, 0x7c, 0x00, 0x7d, 0x44, 0x44, 0x54,
+    0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7f, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f, 0x40,
+    0x5f, 0x51, 0x51, 0x51, 0x51, 0x40, 0x5f, 0x51, 0x51, 0x51, 0x5f, 0x40, 0x5f, 0x51, 0x51, 0x51,
+    0x4e, 0x40, 0x5f, 0x55, 0x55, 0x55, 0x51, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // boot_6 @ 3072 (512 bytes)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x04, 0xf4, 0x14, 0x54, 0x94, 0x74, 0x04, 0xf4, 0x04, 0xc4, 0x04, 0xf4, 0x04, 0xf4, 0x54,
+    0x54, 0x54, 0x14, 0x04, 0xf4, 0x54, 0x54, 0xd4, 0x74, 0x04, 0x14, 0x14, 0xf4, 0x14, 0x14, 0x04,
+    0x14, 0x24, 0xc4, 0x24, 0x14, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x74, 0x54, 0x54, 0x54, 0xd4, 0x04, 0x14, 0x24, 0xc4, 0x24, 0x14,
+    0x04, 0xf4, 0x14, 0x64, 0x14, 0xf4, 0x04, 0xf4, 0x54, 0x54, 0x54, 0xa4, 0x04, 0xf4, 0x14, 0x14,
+    0x14, 0xf4, 0x04, 0xf4, 0x04, 0x04, 0x04, 0x04, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x7d, 0x45, 0x45, 0x54, 0x75, 0x00, 0x7d, 0x15, 0x14, 0x15, 0x7d, 0x00, 0x7d, 0x05,
+    0x19, 0x05, 0x7d, 0x00, 0x7d, 0x00, 0x7c, 0x08, 0x11, 0x20, 0x7c, 0x00, 0x7d, 0x44, 0x44, 0x54,
+    0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x08, 0x10, 0x20, 0x7c, 0x00, 0x7c, 0x14, 0x14, 0x14, 0x7c,
+    0x00, 0x1c, 0x20, 0x40, 0x20, 0x1d, 0x01, 0x7d, 0x01, 0x7d, 0x44, 0x44, 0x54, 0x75, 0x00, 0x7c,
+    0x14, 0x15, 0x14, 0x7c, 0x00, 0x05, 0x04, 0x7d, 0x05, 0x05, 0x01, 0x7c, 0x00, 0x7d, 0x45, 0x45,
+    0x45, 0x7d, 0x00, 0x7d, 0x09, 0x11, 0x21, 0x7d, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7f, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f, 0x40,
+    0x5f, 0x51, 0x51, 0x51, 0x51, 0x40, 0x5f, 0x51, 0x51, 0x51, 0x5f, 0x40, 0x5f, 0x51, 0x51, 0x51,
+    0x4e, 0x40, 0x5f, 0x55, 0x55, 0x55, 0x51, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // boot_7 @ 3584 (512 bytes)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x04, 0xf4, 0x14, 0x54, 0x94, 0x74, 0x04, 0xf4, 0x04, 0xc4, 0x04, 0xf4, 0x04, 0xf4, 0x54,
+    0x54, 0x54, 0x14, 0x04, 0xf4, 0x54, 0x54, 0xd4, 0x74, 0x04, 0x14, 0x14, 0xf4, 0x14, 0x14, 0x04,
+    0x14, 0x24, 0xc4, 0x24, 0x14, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x74, 0x54, 0x54, 0x54, 0xd4, 0x04, 0x14, 0x24, 0xc4, 0x24, 0x14,
+    0x04, 0xf4, 0x14, 0x64, 0x14, 0xf4, 0x04, 0xf4, 0x54, 0x54, 0x54, 0xa4, 0x04, 0xf4, 0x14, 0x14,
+    0x14, 0xf4, 0x04, 0xf4, 0x04, 0x04, 0x04, 0x04, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x7d, 0x45, 0x45, 0x54, 0x75, 0x00, 0x7d, 0x15, 0x14, 0x15, 0x7d, 0x00, 0x7d, 0x05,
+    0x19, 0x05, 0x7d, 0x00, 0x7d, 0x00, 0x7c, 0x08, 0x11, 0x20, 0x7c, 0x00, 0x7d, 0x44, 0x44, 0x54,
+    0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x08, 0x10, 0x20, 0x7c, 0x00, 0x7c, 0x14, 0x14, 0x14, 0x7c,
+    0x00, 0x1c, 0x20, 0x40, 0x20, 0x1d, 0x01, 0x7d, 0x01, 0x7d, 0x44, 0x44, 0x54, 0x75, 0x00, 0x7c,
+    0x14, 0x15, 0x14, 0x7c, 0x00, 0x05, 0x04, 0x7d, 0x05, 0x05, 0x01, 0x7c, 0x00, 0x7d, 0x45, 0x45,
+    0x45, 0x7d, 0x00, 0x7d, 0x09, 0x11, 0x21, 0x7d, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7f, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f, 0x40,
+    0x5f, 0x51, 0x51, 0x51, 0x51, 0x40, 0x5f, 0x51, 0x51, 0x51, 0x5f, 0x40, 0x5f, 0x51, 0x51, 0x51,
+    0x4e, 0x40, 0x5f, 0x55, 0x55, 0x55, 0x51, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x5f, 0x45, 0x45,
+    0x45, 0x41, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f,
+    0x51, 0x51, 0x51, 0x51, 0x40, 0x41, 0x41, 0x5f, 0x41, 0x41, 0x40, 0x5f, 0xc0, 0xdf, 0xd1, 0xd1,
+    0xd1, 0xdf, 0xc0, 0xdf, 0xc2, 0xc4, 0xc8, 0xdf, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // boot_8 @ 4096 (512 bytes)
+    0x80, 0x60, 0x18, 0x06, 0x01, 0x5d, 0x55, 0x55, 0x55, 0x75, 0x01, 0x7d, 0x41, 0x41, 0x41, 0x7d,
+    0x01, 0x7d, 0x15, 0x15, 0x15, 0x1d, 0x01, 0x7d, 0x55, 0x55, 0x55, 0x45, 0x01, 0x7d, 0x15, 0x15,
+    0x35, 0x5d, 0x01, 0xc1, 0x31, 0x0d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0x05, 0xf5, 0x15, 0x55, 0x95, 0x75, 0x05, 0xf5, 0x05, 0xc5, 0x05, 0xf5, 0x05, 0xf5, 0x55,
+    0x55, 0x55, 0x15, 0x05, 0xf5, 0x55, 0x55, 0xd5, 0x75, 0x05, 0x15, 0x15, 0xf5, 0x15, 0x15, 0x05,
+    0x15, 0x25, 0xc5, 0x24, 0x14, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x74, 0x54, 0x54, 0x54, 0xd4, 0x04, 0x14, 0x24, 0xc4, 0x24, 0x14,
+    0x04, 0xf4, 0x14, 0x64, 0x14, 0xf4, 0x04, 0xf4, 0x54, 0x54, 0x54, 0xa4, 0x04, 0xf4, 0x14, 0x14,
+    0x14, 0xf4, 0x04, 0xf4, 0x04, 0x04, 0x04, 0x04, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x7d, 0x45, 0x45, 0x54, 0x75, 0x00, 0x7d, 0x15, 0x14, 0x15, 0x7d, 0x00, 0x7d, 0x05,
+    0x19, 0x05, 0x7d, 0x00, 0x7d, 0x00, 0x7c, 0x08, 0x11, 0x20, 0x7c, 0x00, 0x7d, 0x44, 0x44, 0x54,
+    0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x08, 0x10, 0x20, 0x7c, 0x00, 0x7c, 0x14, 0x14, 0x14, 0x7c,
+    0x00, 0x1c, 0x20, 0x40, 0x20, 0x1d, 0x01, 0x7d, 0x01, 0x7d, 0x44, 0x44, 0x54, 0x75, 0x00, 0x7c,
+    0x14, 0x15, 0x14, 0x7c, 0x00, 0x05, 0x04, 0x7d, 0x05, 0x05, 0x01, 0x7c, 0x00, 0x7d, 0x45, 0x45,
+    0x45, 0x7d, 0x00, 0x7d, 0x09, 0x11, 0x21, 0x7d, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7f, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f, 0x40,
+    0x5f, 0x51, 0x51, 0x51, 0x51, 0x40, 0x5f, 0x51, 0x51, 0x51, 0x5f, 0x40, 0x5f, 0x51, 0x51, 0x51,
+    0x4e, 0x40, 0x5f, 0x55, 0x55, 0x55, 0x51, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x5f, 0x45, 0x45,
+    0x45, 0x41, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f,
+    0x51, 0x51, 0x51, 0x51, 0x40, 0x41, 0x41, 0x5f, 0x41, 0x41, 0x40, 0x5f, 0xc0, 0xdf, 0xd1, 0xd1,
+    0xd1, 0xdf, 0xc0, 0xdf, 0xc2, 0xc4, 0xc8, 0xdf, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // boot_9 @ 4608 (512 bytes)
+    0x80, 0x60, 0x18, 0x06, 0x01, 0x5d, 0x55, 0x55, 0x55, 0x75, 0x01, 0x7d, 0x41, 0x41, 0x41, 0x7d,
+    0x01, 0x7d, 0x15, 0x15, 0x15, 0x1d, 0x01, 0x7d, 0x55, 0x55, 0x55, 0x45, 0x01, 0x7d, 0x15, 0x15,
+    0x35, 0x5d, 0x01, 0xc1, 0x31, 0x8d, 0x63, 0x18, 0x06, 0x01, 0x01, 0x7d, 0x15, 0x15, 0x15, 0x7d,
+    0x01, 0x7d, 0x41, 0x41, 0x41, 0x41, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05, 0x01, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0x05, 0xf5, 0x15, 0x55, 0x95, 0x75, 0x05, 0xf5, 0x05, 0xc5, 0x05, 0xf5, 0x05, 0xf5, 0x55,
+    0x55, 0x55, 0x15, 0x05, 0xf5, 0x55, 0x55, 0xd5, 0x75, 0x05, 0x15, 0x15, 0xf5, 0x15, 0x15, 0x05,
+    0x15, 0x25, 0xc5, 0x24, 0x14, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x74, 0x54, 0x54, 0x54, 0xd4, 0x04, 0x14, 0x24, 0xc4, 0x24, 0x14,
+    0x04, 0xf4, 0x14, 0x64, 0x14, 0xf4, 0x04, 0xf4, 0x54, 0x54, 0x54, 0xa4, 0x04, 0xf4, 0x14, 0x14,
+    0x14, 0xf4, 0x04, 0xf4, 0x04, 0x04, 0x04, 0x04, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x7d, 0x45, 0x45, 0x54, 0x75, 0x00, 0x7d, 0x15, 0x14, 0x15, 0x7d, 0x00, 0x7d, 0x05,
+    0x19, 0x05, 0x7d, 0x00, 0x7d, 0x00, 0x7c, 0x08, 0x11, 0x20, 0x7c, 0x00, 0x7d, 0x44, 0x44, 0x54,
+    0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x08, 0x10, 0x20, 0x7c, 0x00, 0x7c, 0x14, 0x14, 0x14, 0x7c,
+    0x00, 0x1c, 0x20, 0x40, 0x20, 0x1d, 0x01, 0x7d, 0x01, 0x7d, 0x44, 0x44, 0x54, 0x75, 0x00, 0x7c,
+    0x14, 0x15, 0x14, 0x7c, 0x00, 0x05, 0x04, 0x7d, 0x05, 0x05, 0x01, 0x7c, 0x00, 0x7d, 0x45, 0x45,
+    0x45, 0x7d, 0x00, 0x7d, 0x09, 0x11, 0x21, 0x7d, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7f, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f, 0x40,
+    0x5f, 0x51, 0x51, 0x51, 0x51, 0x40, 0x5f, 0x51, 0x51, 0x51, 0x5f, 0x40, 0x5f, 0x51, 0x51, 0x51,
+    0x4e, 0x40, 0x5f, 0x55, 0x55, 0x55, 0x51, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x5f, 0x45, 0x45,
+    0x45, 0x41, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f,
+    0x51, 0x51, 0x51, 0x51, 0x40, 0x41, 0x41, 0x5f, 0x41, 0x41, 0x40, 0x5f, 0xc0, 0xdf, 0xd1, 0xd1,
+    0xd1, 0xdf, 0xc0, 0xdf, 0xc2, 0xc4, 0xc8, 0xdf, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // boot_10 @ 5120 (512 bytes)
+    0x80, 0x60, 0x18, 0x06, 0x01, 0x5d, 0x55, 0x55, 0x55, 0x75, 0x01, 0x7d, 0x41, 0x41, 0x41, 0x7d,
+    0x01, 0x7d, 0x15, 0x15, 0x15, 0x1d, 0x01, 0x7d, 0x55, 0x55, 0x55, 0x45, 0x01, 0x7d, 0x15, 0x15,
+    0x35, 0x5d, 0x01, 0xc1, 0x31, 0x8d, 0x63, 0x18, 0x06, 0x01, 0x01, 0x7d, 0x15, 0x15, 0x15, 0x7d,
+    0x01, 0x7d, 0x41, 0x41, 0x41, 0x41, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05, 0x01, 0xff, 0x00, 0x00,
+    0xff, 0x01, 0x5d, 0x55, 0x55, 0x55, 0x75, 0x01, 0x7d, 0x11, 0x11, 0x11, 0x7d, 0x01, 0x7d, 0x01,
+    0x7d, 0x15, 0x15, 0x15, 0x05, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05, 0x01, 0x01, 0x06, 0x18, 0x60,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0x05, 0xf5, 0x15, 0x55, 0x95, 0x75, 0x05, 0xf5, 0x05, 0xc5, 0x05, 0xf5, 0x05, 0xf5, 0x55,
+    0x55, 0x55, 0x15, 0x05, 0xf5, 0x55, 0x55, 0xd5, 0x75, 0x05, 0x15, 0x15, 0xf5, 0x15, 0x15, 0x05,
+    0x15, 0x25, 0xc5, 0x24, 0x14, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x75, 0x55, 0x55, 0x55, 0xd5, 0x05, 0x15, 0x25, 0xc5, 0x25, 0x15,
+    0x05, 0xf5, 0x15, 0x65, 0x15, 0xf5, 0x05, 0xf5, 0x55, 0x55, 0x55, 0xa5, 0x05, 0xf5, 0x15, 0x15,
+    0x15, 0xf4, 0x04, 0xf4, 0x04, 0x04, 0x04, 0x04, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x7d, 0x45, 0x45, 0x54, 0x75, 0x00, 0x7d, 0x15, 0x14, 0x15, 0x7d, 0x00, 0x7d, 0x05,
+    0x19, 0x05, 0x7d, 0x00, 0x7d, 0x00, 0x7c, 0x08, 0x11, 0x20, 0x7c, 0x00, 0x7d, 0x44, 0x44, 0x54,
+    0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x08, 0x10, 0x20, 0x7c, 0x00, 0x7c, 0x14, 0x14, 0x14, 0x7c,
+    0x00, 0x1c, 0x20, 0x40, 0x20, 0x1d, 0x01, 0x7d, 0x01, 0x7d, 0x44, 0x44, 0x54, 0x75, 0x00, 0x7c,
+    0x14, 0x15, 0x14, 0x7c, 0x00, 0x05, 0x04, 0x7d, 0x05, 0x05, 0x01, 0x7c, 0x00, 0x7d, 0x45, 0x45,
+    0x45, 0x7d, 0x00, 0x7d, 0x09, 0x11, 0x21, 0x7d, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7f, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f, 0x40,
+    0x5f, 0x51, 0x51, 0x51, 0x51, 0x40, 0x5f, 0x51, 0x51, 0x51, 0x5f, 0x40, 0x5f, 0x51, 0x51, 0x51,
+    0x4e, 0x40, 0x5f, 0x55, 0x55, 0x55, 0x51, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x5f, 0x45, 0x45,
+    0x45, 0x41, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f,
+    0x51, 0x51, 0x51, 0x51, 0x40, 0x41, 0x41, 0x5f, 0x41, 0x41, 0x40, 0x5f, 0xc0, 0xdf, 0xd1, 0xd1,
+    0xd1, 0xdf, 0xc0, 0xdf, 0xc2, 0xc4, 0xc8, 0xdf, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // boot_11 @ 5632 (512 bytes)
+    0x80, 0x60, 0x18, 0x06, 0x01, 0x5d, 0x55, 0x55, 0x55, 0x75, 0x01, 0x7d, 0x41, 0x41, 0x41, 0x7d,
+    0x01, 0x7d, 0x15, 0x15, 0x15, 0x1d, 0x01, 0x7d, 0x55, 0x55, 0x55, 0x45, 0x01, 0x7d, 0x15, 0x15,
+    0x35, 0x5d, 0x01, 0xc1, 0x31, 0x8d, 0x63, 0x18, 0x06, 0x01, 0x01, 0x7d, 0x15, 0x15, 0x15, 0x7d,
+    0x01, 0x7d, 0x41, 0x41, 0x41, 0x41, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05, 0x01, 0xff, 0x00, 0x00,
+    0xff, 0x01, 0x5d, 0x55, 0x55, 0x55, 0x75, 0x01, 0x7d, 0x11, 0x11, 0x11, 0x7d, 0x01, 0x7d, 0x01,
+    0x7d, 0x15, 0x15, 0x15, 0x05, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05, 0x01, 0x01, 0x06, 0x18, 0x63,
+    0x8d, 0x31, 0xc1, 0x01, 0x7d, 0x45, 0x45, 0x45, 0x45, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05, 0x01,
+    0x7d, 0x15, 0x15, 0x35, 0x5d, 0x01, 0x7d, 0x41, 0x41, 0x41, 0x41, 0x01, 0x06, 0x18, 0x60, 0x80,
+    0xfd, 0x05, 0xf5, 0x15, 0x55, 0x95, 0x75, 0x05, 0xf5, 0x05, 0xc5, 0x05, 0xf5, 0x05, 0xf5, 0x55,
+    0x55, 0x55, 0x15, 0x05, 0xf5, 0x55, 0x55, 0xd5, 0x75, 0x05, 0x15, 0x15, 0xf5, 0x15, 0x15, 0x05,
+    0x15, 0x25, 0xc5, 0x24, 0x14, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x75, 0x55, 0x55, 0x55, 0xd5, 0x05, 0x15, 0x25, 0xc5, 0x25, 0x15,
+    0x05, 0xf5, 0x15, 0x65, 0x15, 0xf5, 0x05, 0xf5, 0x55, 0x55, 0x55, 0xa5, 0x05, 0xf5, 0x15, 0x15,
+    0x15, 0xf4, 0x04, 0xf5, 0x05, 0x05, 0x05, 0x05, 0x05, 0xfd, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xff, 0x00, 0x7d, 0x45, 0x45, 0x54, 0x75, 0x00, 0x7d, 0x15, 0x14, 0x15, 0x7d, 0x00, 0x7d, 0x05,
+    0x19, 0x05, 0x7d, 0x00, 0x7d, 0x00, 0x7c, 0x08, 0x11, 0x20, 0x7c, 0x00, 0x7d, 0x44, 0x44, 0x54,
+    0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x08, 0x10, 0x20, 0x7c, 0x00, 0x7c, 0x14, 0x14, 0x14, 0x7c,
+    0x00, 0x1c, 0x20, 0x40, 0x20, 0x1d, 0x01, 0x7d, 0x01, 0x7d, 0x44, 0x44, 0x54, 0x75, 0x00, 0x7c,
+    0x14, 0x15, 0x14, 0x7c, 0x00, 0x05, 0x04, 0x7d, 0x05, 0x05, 0x01, 0x7c, 0x00, 0x7d, 0x45, 0x45,
+    0x45, 0x7d, 0x00, 0x7d, 0x09, 0x11, 0x21, 0x7d, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7f, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f, 0x40,
+    0x5f, 0x51, 0x51, 0x51, 0x51, 0x40, 0x5f, 0x51, 0x51, 0x51, 0x5f, 0x40, 0x5f, 0x51, 0x51, 0x51,
+    0x4e, 0x40, 0x5f, 0x55, 0x55, 0x55, 0x51, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x5f, 0x45, 0x45,
+    0x45, 0x41, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f,
+    0x51, 0x51, 0x51, 0x51, 0x40, 0x41, 0x41, 0x5f, 0x41, 0x41, 0x40, 0x5f, 0xc0, 0xdf, 0xd1, 0xd1,
+    0xd1, 0xdf, 0xc0, 0xdf, 0xc2, 0xc4, 0xc8, 0xdf, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // boot_12 @ 6144 (512 bytes)
+    0x80, 0x60, 0x18, 0x06, 0x01, 0x5d, 0x55, 0x55, 0x55, 0x75, 0x01, 0x7d, 0x41, 0x41, 0x41, 0x7d,
+    0x01, 0x7d, 0x15, 0x15, 0x15, 0x1d, 0x01, 0x7d, 0x55, 0x55, 0x55, 0x45, 0x01, 0x7d, 0x15, 0x15,
+    0x35, 0x5d, 0x01, 0xc1, 0x31, 0x8d, 0x63, 0x18, 0x06, 0x01, 0x01, 0x7d, 0x15, 0x15, 0x15, 0x7d,
+    0x01, 0x7d, 0x41, 0x41, 0x41, 0x41, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05, 0x01, 0xff, 0x00, 0x00,
+    0xff, 0x01, 0x5d, 0x55, 0x55, 0x55, 0x75, 0x01, 0x7d, 0x11, 0x11, 0x11, 0x7d, 0x01, 0x7d, 0x01,
+    0x7d, 0x15, 0x15, 0x15, 0x05, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05, 0x01, 0x01, 0x06, 0x18, 0x63,
+    0x8d, 0x31, 0xc1, 0x01, 0x7d, 0x45, 0x45, 0x45, 0x45, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05, 0x01,
+    0x7d, 0x15, 0x15, 0x35, 0x5d, 0x01, 0x7d, 0x41, 0x41, 0x41, 0x41, 0x01, 0x06, 0x18, 0x60, 0x80,
+    0xfd, 0x05, 0xf5, 0x15, 0x55, 0x95, 0x75, 0x05, 0xf5, 0x05, 0xc5, 0x05, 0xf5, 0x05, 0xf5, 0x55,
+    0x55, 0x55, 0x15, 0x05, 0xf5, 0x55, 0x55, 0xd5, 0x75, 0x05, 0x15, 0x15, 0xf5, 0x15, 0x15, 0x05,
+    0x15, 0x25, 0xc5, 0x24, 0x14, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x75, 0x55, 0x55, 0x55, 0xd5, 0x05, 0x15, 0x25, 0xc5, 0x25, 0x15,
+    0x05, 0xf5, 0x15, 0x65, 0x15, 0xf5, 0x05, 0xf5, 0x55, 0x55, 0x55, 0xa5, 0x05, 0xf5, 0x15, 0x15,
+    0x15, 0xf4, 0x04, 0xf5, 0x05, 0x05, 0x05, 0x05, 0x05, 0xfd, 0x01, 0xfd, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xfd,
+    0xff, 0x00, 0x7d, 0x45, 0x45, 0x54, 0x75, 0x00, 0x7d, 0x15, 0x14, 0x15, 0x7d, 0x00, 0x7d, 0x05,
+    0x19, 0x05, 0x7d, 0x00, 0x7d, 0x00, 0x7c, 0x08, 0x11, 0x20, 0x7c, 0x00, 0x7d, 0x44, 0x44, 0x54,
+    0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x08, 0x10, 0x20, 0x7c, 0x00, 0x7c, 0x14, 0x14, 0x14, 0x7c,
+    0x00, 0x1c, 0x20, 0x40, 0x20, 0x1d, 0x01, 0x7d, 0x01, 0x7d, 0x44, 0x44, 0x54, 0x75, 0x00, 0x7c,
+    0x14, 0x15, 0x14, 0x7c, 0x00, 0x05, 0x04, 0x7d, 0x05, 0x05, 0x01, 0x7c, 0x00, 0x7d, 0x45, 0x45,
+    0x45, 0x7d, 0x00, 0x7d, 0x09, 0x11, 0x21, 0x7d, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0x7f, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f, 0x40,
+    0x5f, 0x51, 0x51, 0x51, 0x51, 0x40, 0x5f, 0x51, 0x51, 0x51, 0x5f, 0x40, 0x5f, 0x51, 0x51, 0x51,
+    0x4e, 0x40, 0x5f, 0x55, 0x55, 0x55, 0x51, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x5f, 0x45, 0x45,
+    0x45, 0x41, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f,
+    0x51, 0x51, 0x51, 0x51, 0x40, 0x41, 0x41, 0x5f, 0x41, 0x41, 0x40, 0x5f, 0xc0, 0xdf, 0xd1, 0xd1,
+    0xd1, 0xdf, 0xc0, 0xdf, 0xc2, 0xc4, 0xc8, 0xdf, 0xc0, 0xff, 0x00, 0xff, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff,
+    // boot_13 @ 6656 (512 bytes)
+    0x80, 0x60, 0x18, 0x06, 0x01, 0x5d, 0x55, 0x55, 0x55, 0x75, 0x01, 0x7d, 0x41, 0x41, 0x41, 0x7d,
+    0x01, 0x7d, 0x15, 0x15, 0x15, 0x1d, 0x01, 0x7d, 0x55, 0x55, 0x55, 0x45, 0x01, 0x7d, 0x15, 0x15,
+    0x35, 0x5d, 0x01, 0xc1, 0x31, 0x8d, 0x63, 0x18, 0x06, 0x01, 0x01, 0x7d, 0x15, 0x15, 0x15, 0x7d,
+    0x01, 0x7d, 0x41, 0x41, 0x41, 0x41, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05, 0x01, 0xff, 0x00, 0x00,
+    0xff, 0x01, 0x5d, 0x55, 0x55, 0x55, 0x75, 0x01, 0x7d, 0x11, 0x11, 0x11, 0x7d, 0x01, 0x7d, 0x01,
+    0x7d, 0x15, 0x15, 0x15, 0x05, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05, 0x01, 0x01, 0x06, 0x18, 0x63,
+    0x8d, 0x31, 0xc1, 0x01, 0x7d, 0x45, 0x45, 0x45, 0x45, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05, 0x01,
+    0x7d, 0x15, 0x15, 0x35, 0x5d, 0x01, 0x7d, 0x41, 0x41, 0x41, 0x41, 0x01, 0x06, 0x18, 0x60, 0x80,
+    0xfd, 0x05, 0xf5, 0x15, 0x55, 0x95, 0x75, 0x05, 0xf5, 0x05, 0xc5, 0x05, 0xf5, 0x05, 0xf5, 0x55,
+    0x55, 0x55, 0x15, 0x05, 0xf5, 0x55, 0x55, 0xd5, 0x75, 0x05, 0x15, 0x15, 0xf5, 0x15, 0x15, 0x05,
+    0x15, 0x25, 0xc5, 0x24, 0x14, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x75, 0x55, 0x55, 0x55, 0xd5, 0x05, 0x15, 0x25, 0xc5, 0x25, 0x15,
+    0x05, 0xf5, 0x15, 0x65, 0x15, 0xf5, 0x05, 0xf5, 0x55, 0x55, 0x55, 0xa5, 0x05, 0xf5, 0x15, 0x15,
+    0x15, 0xf4, 0x04, 0xf5, 0x05, 0x05, 0x05, 0x05, 0x05, 0xfd, 0x01, 0xfd, 0x05, 0xf5, 0x05, 0xc5,
+    0x05, 0xf5, 0x05, 0xf5, 0x55, 0x55, 0x55, 0x75, 0x05, 0xf5, 0x15, 0x65, 0x15, 0xf5, 0x05, 0xfd,
+    0xff, 0x00, 0x7d, 0x45, 0x45, 0x54, 0x75, 0x00, 0x7d, 0x15, 0x14, 0x15, 0x7d, 0x00, 0x7d, 0x05,
+    0x19, 0x05, 0x7d, 0x00, 0x7d, 0x00, 0x7c, 0x08, 0x11, 0x20, 0x7c, 0x00, 0x7d, 0x44, 0x44, 0x54,
+    0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x08, 0x10, 0x20, 0x7c, 0x00, 0x7c, 0x14, 0x14, 0x14, 0x7c,
+    0x00, 0x1c, 0x20, 0x40, 0x20, 0x1d, 0x01, 0x7d, 0x01, 0x7d, 0x44, 0x44, 0x54, 0x75, 0x00, 0x7c,
+    0x14, 0x15, 0x14, 0x7c, 0x00, 0x05, 0x04, 0x7d, 0x05, 0x05, 0x01, 0x7c, 0x00, 0x7d, 0x45, 0x45,
+    0x45, 0x7d, 0x00, 0x7d, 0x09, 0x11, 0x21, 0x7d, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x01, 0x00,
+    0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff,
+    0x7f, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f, 0x40,
+    0x5f, 0x51, 0x51, 0x51, 0x51, 0x40, 0x5f, 0x51, 0x51, 0x51, 0x5f, 0x40, 0x5f, 0x51, 0x51, 0x51,
+    0x4e, 0x40, 0x5f, 0x55, 0x55, 0x55, 0x51, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x5f, 0x45, 0x45,
+    0x45, 0x41, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f,
+    0x51, 0x51, 0x51, 0x51, 0x40, 0x41, 0x41, 0x5f, 0x41, 0x41, 0x40, 0x5f, 0xc0, 0xdf, 0xd1, 0xd1,
+    0xd1, 0xdf, 0xc0, 0xdf, 0xc2, 0xc4, 0xc8, 0xdf, 0xc0, 0xff, 0x00, 0xff, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff,
+    // boot_14 @ 7168 (512 bytes)
+    0x80, 0x60, 0x18, 0x06, 0x01, 0x5d, 0x55, 0x55, 0x55, 0x75, 0x01, 0x7d, 0x41, 0x41, 0x41, 0x7d,
+    0x01, 0x7d, 0x15, 0x15, 0x15, 0x1d, 0x01, 0x7d, 0x55, 0x55, 0x55, 0x45, 0x01, 0x7d, 0x15, 0x15,
+    0x35, 0x5d, 0x01, 0xc1, 0x31, 0x8d, 0x63, 0x18, 0x06, 0x01, 0x01, 0x7d, 0x15, 0x15, 0x15, 0x7d,
+    0x01, 0x7d, 0x41, 0x41, 0x41, 0x41, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05, 0x01, 0xff, 0x00, 0x00,
+    0xff, 0x01, 0x5d, 0x55, 0x55, 0x55, 0x75, 0x01, 0x7d, 0x11, 0x11, 0x11, 0x7d, 0x01, 0x7d, 0x01,
+    0x7d, 0x15, 0x15, 0x15, 0x05, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05, 0x01, 0x01, 0x06, 0x18, 0x63,
+    0x8d, 0x31, 0xc1, 0x01, 0x7d, 0x45, 0x45, 0x45, 0x45, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05, 0x01,
+    0x7d, 0x15, 0x15, 0x35, 0x5d, 0x01, 0x7d, 0x41, 0x41, 0x41, 0x41, 0x01, 0x06, 0x18, 0x60, 0x80,
+    0xfd, 0x05, 0xf5, 0x15, 0x55, 0x95, 0x75, 0x05, 0xf5, 0x05, 0xc5, 0x05, 0xf5, 0x05, 0xf5, 0x55,
+    0x55, 0x55, 0x15, 0x05, 0xf5, 0x55, 0x55, 0xd5, 0x75, 0x05, 0x15, 0x15, 0xf5, 0x15, 0x15, 0x05,
+    0x15, 0x25, 0xc5, 0x24, 0x14, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x75, 0x55, 0x55, 0x55, 0xd5, 0x05, 0x15, 0x25, 0xc5, 0x25, 0x15,
+    0x05, 0xf5, 0x15, 0x65, 0x15, 0xf5, 0x05, 0xf5, 0x55, 0x55, 0x55, 0xa5, 0x05, 0xf5, 0x15, 0x15,
+    0x15, 0xf4, 0x04, 0xf5, 0x05, 0x05, 0x05, 0x05, 0x05, 0xfd, 0x01, 0xfd, 0x05, 0xf5, 0x05, 0xc5,
+    0x05, 0xf5, 0x05, 0xf5, 0x55, 0x55, 0x55, 0x75, 0x05, 0xf5, 0x15, 0x65, 0x15, 0xf5, 0x05, 0xfd,
+    0xff, 0x00, 0x7d, 0x45, 0x45, 0x54, 0x75, 0x00, 0x7d, 0x15, 0x14, 0x15, 0x7d, 0x00, 0x7d, 0x05,
+    0x19, 0x05, 0x7d, 0x00, 0x7d, 0x00, 0x7c, 0x08, 0x11, 0x20, 0x7c, 0x00, 0x7d, 0x44, 0x44, 0x54,
+    0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x08, 0x10, 0x20, 0x7c, 0x00, 0x7c, 0x14, 0x14, 0x14, 0x7c,
+    0x00, 0x1c, 0x20, 0x40, 0x20, 0x1d, 0x01, 0x7d, 0x01, 0x7d, 0x44, 0x44, 0x54, 0x75, 0x00, 0x7c,
+    0x14, 0x15, 0x14, 0x7c, 0x00, 0x05, 0x04, 0x7d, 0x05, 0x05, 0x01, 0x7c, 0x00, 0x7d, 0x45, 0x45,
+    0x45, 0x7d, 0x00, 0x7d, 0x09, 0x11, 0x21, 0x7d, 0x00, 0xff, 0x00, 0xff, 0x00, 0x19, 0x0d, 0x14,
+    0x19, 0x0d, 0x14, 0x19, 0x0c, 0x14, 0x18, 0x0c, 0x14, 0x19, 0x0c, 0x14, 0x18, 0x0d, 0x00, 0xff,
+    0x7f, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f, 0x40,
+    0x5f, 0x51, 0x51, 0x51, 0x51, 0x40, 0x5f, 0x51, 0x51, 0x51, 0x5f, 0x40, 0x5f, 0x51, 0x51, 0x51,
+    0x4e, 0x40, 0x5f, 0x55, 0x55, 0x55, 0x51, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x5f, 0x45, 0x45,
+    0x45, 0x41, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f,
+    0x51, 0x51, 0x51, 0x51, 0x40, 0x41, 0x41, 0x5f, 0x41, 0x41, 0x40, 0x5f, 0xc0, 0xdf, 0xd1, 0xd1,
+    0xd1, 0xdf, 0xc0, 0xdf, 0xc2, 0xc4, 0xc8, 0xdf, 0xc0, 0xff, 0x00, 0xff, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff,
+    // boot_15 @ 7680 (512 bytes)
+    0x80, 0x60, 0x18, 0x06, 0x01, 0x5d, 0x55, 0x55, 0x55, 0x75, 0x01, 0x7d, 0x41, 0x41, 0x41, 0x7d,
+    0x01, 0x7d, 0x15, 0x15, 0x15, 0x1d, 0x01, 0x7d, 0x55, 0x55, 0x55, 0x45, 0x01, 0x7d, 0x15, 0x15,
+    0x35, 0x5d, 0x01, 0xc1, 0x31, 0x8d, 0x63, 0x18, 0x06, 0x01, 0x01, 0x7d, 0x15, 0x15, 0x15, 0x7d,
+    0x01, 0x7d, 0x41, 0x41, 0x41, 0x41, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05, 0x01, 0xff, 0x00, 0x00,
+    0xff, 0x01, 0x5d, 0x55, 0x55, 0x55, 0x75, 0x01, 0x7d, 0x11, 0x11, 0x11, 0x7d, 0x01, 0x7d, 0x01,
+    0x7d, 0x15, 0x15, 0x15, 0x05, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05, 0x01, 0x01, 0x06, 0x18, 0x63,
+    0x8d, 0x31, 0xc1, 0x01, 0x7d, 0x45, 0x45, 0x45, 0x45, 0x01, 0x05, 0x05, 0x7d, 0x05, 0x05, 0x01,
+    0x7d, 0x15, 0x15, 0x35, 0x5d, 0x01, 0x7d, 0x41, 0x41, 0x41, 0x41, 0x01, 0x06, 0x18, 0x60, 0x80,
+    0xfd, 0x05, 0xf5, 0x15, 0x55, 0x95, 0x75, 0x05, 0xf5, 0x05, 0xc5, 0x05, 0xf5, 0x05, 0xf5, 0x55,
+    0x55, 0x55, 0x15, 0x05, 0xf5, 0x55, 0x55, 0xd5, 0x75, 0x05, 0x15, 0x15, 0xf5, 0x15, 0x15, 0x05,
+    0x15, 0x25, 0xc5, 0x24, 0x14, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x75, 0x55, 0x55, 0x55, 0xd5, 0x05, 0x15, 0x25, 0xc5, 0x25, 0x15,
+    0x05, 0xf5, 0x15, 0x65, 0x15, 0xf5, 0x05, 0xf5, 0x55, 0x55, 0x55, 0xa5, 0x05, 0xf5, 0x15, 0x15,
+    0x15, 0xf4, 0x04, 0xf5, 0x05, 0x05, 0x05, 0x05, 0x05, 0xfd, 0x01, 0xfd, 0x05, 0xf5, 0x05, 0xc5,
+    0x05, 0xf5, 0x05, 0xf5, 0x55, 0x55, 0x55, 0x75, 0x05, 0xf5, 0x15, 0x65, 0x15, 0xf5, 0x05, 0xfd,
+    0xff, 0x00, 0x7d, 0x45, 0x45, 0x54, 0x75, 0x00, 0x7d, 0x15, 0x14, 0x15, 0x7d, 0x00, 0x7d, 0x05,
+    0x19, 0x05, 0x7d, 0x00, 0x7d, 0x00, 0x7c, 0x08, 0x11, 0x20, 0x7c, 0x00, 0x7d, 0x44, 0x44, 0x54,
+    0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x08, 0x10, 0x20, 0x7c, 0x00, 0x7c, 0x14, 0x14, 0x14, 0x7c,
+    0x00, 0x1c, 0x20, 0x40, 0x20, 0x1d, 0x01, 0x7d, 0x01, 0x7d, 0x44, 0x44, 0x54, 0x75, 0x00, 0x7c,
+    0x14, 0x15, 0x14, 0x7c, 0x00, 0x05, 0x04, 0x7d, 0x05, 0x05, 0x01, 0x7c, 0x00, 0x7d, 0x45, 0x45,
+    0x45, 0x7d, 0x00, 0x7d, 0x09, 0x11, 0x21, 0x7d, 0x00, 0xff, 0x00, 0xff, 0x00, 0x19, 0x0d, 0x14,
+    0x19, 0x0d, 0x14, 0x19, 0x0c, 0x14, 0x18, 0x0c, 0x14, 0x19, 0x0c, 0x14, 0x18, 0x0d, 0x00, 0xff,
+    0x7f, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f, 0x40,
+    0x5f, 0x51, 0x51, 0x51, 0x51, 0x40, 0x5f, 0x51, 0x51, 0x51, 0x5f, 0x40, 0x5f, 0x51, 0x51, 0x51,
+    0x4e, 0x40, 0x5f, 0x55, 0x55, 0x55, 0x51, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x5f, 0x45, 0x45,
+    0x45, 0x41, 0x40, 0x5f, 0x50, 0x50, 0x50, 0x5f, 0x40, 0x5f, 0x42, 0x44, 0x48, 0x5f, 0x40, 0x5f,
+    0x51, 0x51, 0x51, 0x51, 0x40, 0x41, 0x41, 0x5f, 0x41, 0x41, 0x40, 0x5f, 0xc0, 0xdf, 0xd1, 0xd1,
+    0xd1, 0xdf, 0xc0, 0xdf, 0xc2, 0xc4, 0xc8, 0xdf, 0xc0, 0xff, 0x00, 0xff, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff,
+};
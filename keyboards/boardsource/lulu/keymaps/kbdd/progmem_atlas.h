@@ -0,0 +1,149 @@
+#pragma once
+
+// Generated by build_atlas.py from progmem_anim.c, do not edit.
+
+#include QMK_KEYBOARD_H
+
+extern const uint8_t asset_atlas[];
+extern const uint8_t PROGMEM asset_atlas_cold[];
+
+#define ATLAS(name) (ATLAS_BASE_##name + ATLAS_OFFSET_##name)
+
+#define ATLAS_BASE_super_0 asset_atlas
+#define ATLAS_OFFSET_super_0 0
+#define ATLAS_BASE_alt_0 asset_atlas
+#define ATLAS_OFFSET_alt_0 78
+#define ATLAS_BASE_shift_0 asset_atlas
+#define ATLAS_OFFSET_shift_0 128
+#define ATLAS_BASE_ctrl_0 asset_atlas
+#define ATLAS_OFFSET_ctrl_0 194
+#define ATLAS_BASE_super_1 asset_atlas
+#define ATLAS_OFFSET_super_1 260
+#define ATLAS_BASE_alt_1 asset_atlas
+#define ATLAS_OFFSET_alt_1 338
+#define ATLAS_BASE_shift_1 asset_atlas
+#define ATLAS_OFFSET_shift_1 388
+#define ATLAS_BASE_ctrl_1 asset_atlas
+#define ATLAS_OFFSET_ctrl_1 454
+#define ATLAS_BASE_super_2 asset_atlas
+#define ATLAS_OFFSET_super_2 520
+#define ATLAS_BASE_alt_2 asset_atlas
+#define ATLAS_OFFSET_alt_2 598
+#define ATLAS_BASE_shift_2 asset_atlas
+#define ATLAS_OFFSET_shift_2 648
+#define ATLAS_BASE_ctrl_2 asset_atlas
+#define ATLAS_OFFSET_ctrl_2 714
+#define ATLAS_BASE_super_3 asset_atlas
+#define ATLAS_OFFSET_super_3 780
+#define ATLAS_BASE_alt_3 asset_atlas
+#define ATLAS_OFFSET_alt_3 858
+#define ATLAS_BASE_shift_3 asset_atlas
+#define ATLAS_OFFSET_shift_3 908
+#define ATLAS_BASE_ctrl_3 asset_atlas
+#define ATLAS_OFFSET_ctrl_3 974
+#define ATLAS_BASE_qwerty_0 asset_atlas
+#define ATLAS_OFFSET_qwerty_0 1040
+#define ATLAS_BASE_gaming_0 asset_atlas
+#define ATLAS_OFFSET_gaming_0 1088
+#define ATLAS_BASE_unicode_0 asset_atlas
+#define ATLAS_OFFSET_unicode_0 1136
+#define ATLAS_BASE_symbol_0 asset_atlas
+#define ATLAS_OFFSET_symbol_0 1184
+#define ATLAS_BASE_navigation_0 asset_atlas
+#define ATLAS_OFFSET_navigation_0 1232
+#define ATLAS_BASE_function_0 asset_atlas
+#define ATLAS_OFFSET_function_0 1296
+#define ATLAS_BASE_qwerty_1 asset_atlas
+#define ATLAS_OFFSET_qwerty_1 1352
+#define ATLAS_BASE_gaming_1 asset_atlas
+#define ATLAS_OFFSET_gaming_1 1400
+#define ATLAS_BASE_unicode_1 asset_atlas
+#define ATLAS_OFFSET_unicode_1 1448
+#define ATLAS_BASE_symbol_1 asset_atlas
+#define ATLAS_OFFSET_symbol_1 1496
+#define ATLAS_BASE_navigation_1 asset_atlas
+#define ATLAS_OFFSET_navigation_1 1544
+#define ATLAS_BASE_function_1 asset_atlas
+#define ATLAS_OFFSET_function_1 1608
+#define ATLAS_BASE_qwerty_2 asset_atlas
+#define ATLAS_OFFSET_qwerty_2 1664
+#define ATLAS_BASE_gaming_2 asset_atlas
+#define ATLAS_OFFSET_gaming_2 1712
+#define ATLAS_BASE_unicode_2 asset_atlas
+#define ATLAS_OFFSET_unicode_2 1760
+#define ATLAS_BASE_symbol_2 asset_atlas
+#define ATLAS_OFFSET_symbol_2 1808
+#define ATLAS_BASE_navigation_2 asset_atlas
+#define ATLAS_OFFSET_navigation_2 1856
+#define ATLAS_BASE_function_2 asset_atlas
+#define ATLAS_OFFSET_function_2 1920
+#define ATLAS_BASE_qwerty_3 asset_atlas
+#define ATLAS_OFFSET_qwerty_3 1976
+#define ATLAS_BASE_gaming_3 asset_atlas
+#define ATLAS_OFFSET_gaming_3 2024
+#define ATLAS_BASE_unicode_3 asset_atlas
+#define ATLAS_OFFSET_unicode_3 2072
+#define ATLAS_BASE_symbol_3 asset_atlas
+#define ATLAS_OFFSET_symbol_3 2120
+#define ATLAS_BASE_navigation_3 asset_atlas
+#define ATLAS_OFFSET_navigation_3 2168
+#define ATLAS_BASE_function_3 asset_atlas
+#define ATLAS_OFFSET_function_3 2232
+#define ATLAS_BASE_digit_0 asset_atlas
+#define ATLAS_OFFSET_digit_0 2288
+#define ATLAS_BASE_digit_1 asset_atlas
+#define ATLAS_OFFSET_digit_1 2293
+#define ATLAS_BASE_digit_2 asset_atlas
+#define ATLAS_OFFSET_digit_2 2298
+#define ATLAS_BASE_digit_3 asset_atlas
+#define ATLAS_OFFSET_digit_3 2303
+#define ATLAS_BASE_digit_4 asset_atlas
+#define ATLAS_OFFSET_digit_4 2308
+#define ATLAS_BASE_digit_5 asset_atlas
+#define ATLAS_OFFSET_digit_5 2313
+#define ATLAS_BASE_digit_6 asset_atlas
+#define ATLAS_OFFSET_digit_6 2318
+#define ATLAS_BASE_digit_7 asset_atlas
+#define ATLAS_OFFSET_digit_7 2323
+#define ATLAS_BASE_digit_8 asset_atlas
+#define ATLAS_OFFSET_digit_8 2328
+#define ATLAS_BASE_digit_9 asset_atlas
+#define ATLAS_OFFSET_digit_9 2333
+#define ATLAS_BASE_colon asset_atlas
+#define ATLAS_OFFSET_colon 2338
+#define ATLAS_BASE_am asset_atlas
+#define ATLAS_OFFSET_am 2339
+#define ATLAS_BASE_pm asset_atlas
+#define ATLAS_OFFSET_pm 2344
+#define ATLAS_BASE_boot_0 asset_atlas_cold
+#define ATLAS_OFFSET_boot_0 0
+#define ATLAS_BASE_boot_1 asset_atlas_cold
+#define ATLAS_OFFSET_boot_1 512
+#define ATLAS_BASE_boot_2 asset_atlas_cold
+#define ATLAS_OFFSET_boot_2 1024
+#define ATLAS_BASE_boot_3 asset_atlas_cold
+#define ATLAS_OFFSET_boot_3 1536
+#define ATLAS_BASE_boot_4 asset_atlas_cold
+#define ATLAS_OFFSET_boot_4 2048
+#define ATLAS_BASE_boot_5 asset_atlas_cold
+#define ATLAS_OFFSET_boot_5 2560
+#define ATLAS_BASE_boot_6 asset_atlas_cold
+#define ATLAS_OFFSET_boot_6 3072
+#define ATLAS_BASE_boot_7 asset_atlas_cold
+#define ATLAS_OFFSET_boot_7 3584
+#define ATLAS_BASE_boot_8 asset_atlas_cold
+#define ATLAS_OFFSET_boot_8 4096
+#define ATLAS_BASE_boot_9 asset_atlas_cold
+#define ATLAS_OFFSET_boot_9 4608
+#define ATLAS_BASE_boot_10 asset_atlas_cold
+#define ATLAS_OFFSET_boot_10 5120
+#define ATLAS_BASE_boot_11 asset_atlas_cold
+#define ATLAS_OFFSET_boot_11 5632
+#define ATLAS_BASE_boot_12 asset_atlas_cold
+#define ATLAS_OFFSET_boot_12 6144
+#define ATLAS_BASE_boot_13 asset_atlas_cold
+#define ATLAS_OFFSET_boot_13 6656
+#define ATLAS_BASE_boot_14 asset_atlas_cold
+#define ATLAS_OFFSET_boot_14 7168
+#define ATLAS_BASE_boot_15 asset_atlas_cold
+#define ATLAS_OFFSET_boot_15 7680
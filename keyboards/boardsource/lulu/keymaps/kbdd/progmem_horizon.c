@@ -1,9 +1,10 @@
 #include <sys/types.h>
 #include QMK_KEYBOARD_H
 #include "progmem_horizon.h"
+#include "hot_path.h"
 
 // 128x32
-const uint8_t PROGMEM horizon_0[] = {
+const uint8_t HOT_DATA(horizon_0)[] = {
     0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
     0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
     0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
@@ -37,7 +38,7 @@ const uint8_t PROGMEM horizon_0[] = {
     0x63, 0x63, 0x63, 0x65, 0x65, 0x69, 0x69, 0x71, 0x71, 0x73, 0x63, 0x65, 0x65, 0x69, 0x69, 0x73,
     0x73, 0x73, 0x65, 0x65, 0x69, 0xeb, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xe5, 0xe5, 0xe7, 0xe7, 0xff
 };
-const uint8_t PROGMEM horizon_1[] = {
+const uint8_t HOT_DATA(horizon_1)[] = {
     0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
     0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
     0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
@@ -71,7 +72,7 @@ const uint8_t PROGMEM horizon_1[] = {
     0x62, 0x62, 0x62, 0x66, 0x66, 0x6a, 0x6b, 0x73, 0x73, 0x72, 0x62, 0x66, 0x67, 0x6b, 0x6b, 0x72,
     0x72, 0x72, 0x67, 0x67, 0x6b, 0xea, 0xea, 0xf2, 0xf2, 0xf2, 0xf3, 0xe7, 0xe7, 0xe6, 0xe6, 0xff
 };
-const uint8_t PROGMEM horizon_2[] = {
+const uint8_t HOT_DATA(horizon_2)[] = {
     0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
     0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
     0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
@@ -105,7 +106,7 @@ const uint8_t PROGMEM horizon_2[] = {
     0x66, 0x66, 0x66, 0x64, 0x64, 0x6c, 0x6d, 0x75, 0x75, 0x76, 0x66, 0x64, 0x65, 0x6d, 0x6d, 0x76,
     0x76, 0x76, 0x65, 0x65, 0x6d, 0xee, 0xee, 0xf6, 0xf6, 0xf6, 0xf7, 0xe5, 0xe5, 0xe6, 0xe6, 0xff
 };
-const uint8_t PROGMEM horizon_3[] = {
+const uint8_t HOT_DATA(horizon_3)[] = {
     0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
     0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
     0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
@@ -0,0 +1,77 @@
+/**
+ * @file render_state.c
+ * @brief Single-producer/single-consumer snapshot channel for the OLED
+ *
+ * One slot behind a sequence lock: the producer makes the sequence odd,
+ * writes the slot and makes it even again; the consumer copies the slot and
+ * keeps the copy only if the sequence was even and unchanged around it. The
+ * newest snapshot always wins, so a consumer that stops reading, say while
+ * the OLED is off, gets the current state on its next read. Only the
+ * producer writes the sequence, so plain acquire/release loads and stores
+ * are enough; nothing needs a read-modify-write instruction (the RP2040's
+ * M0+ has none).
+ */
+
+#include QMK_KEYBOARD_H
+#include "render_state.h"
+#include "anim.h"
+#include "wpm_stats.h"
+
+static render_state_t slot;
+static uint32_t       sequence = 0; // written by the producer only
+static uint32_t       consumed = 0; // consumer only: last sequence read
+
+static render_state_t last_published;
+static bool           published_once = false;
+
+void render_state_capture(render_state_t *state) {
+    state->layer   = get_highest_layer(layer_state);
+    state->mods    = get_mods() | get_oneshot_mods();
+    state->wpm     = wpm_stats_get_current();
+    state->wpm_avg = wpm_stats_get_average();
+    state->clock   = clock_now();
+}
+
+// Field by field: the struct has padding before clock, which memcmp would
+// compare too.
+static bool render_state_equal(const render_state_t *a, const render_state_t *b) {
+    return a->layer == b->layer && a->mods == b->mods && a->wpm == b->wpm && a->wpm_avg == b->wpm_avg && a->clock == b->clock;
+}
+
+void render_state_publish(void) {
+    render_state_t state;
+    render_state_capture(&state);
+
+    if (published_once && render_state_equal(&state, &last_published)) {
+        return;
+    }
+
+    uint32_t s = __atomic_load_n(&sequence, __ATOMIC_RELAXED);
+    __atomic_store_n(&sequence, s + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    slot = state;
+    __atomic_store_n(&sequence, s + 2, __ATOMIC_RELEASE);
+
+    last_published = state;
+    published_once = true;
+}
+
+bool render_state_consume(render_state_t *state) {
+    for (;;) {
+        uint32_t before = __atomic_load_n(&sequence, __ATOMIC_ACQUIRE);
+        if (before == consumed) {
+            return false;
+        }
+        if (before & 1) {
+            continue; // mid-publish
+        }
+
+        render_state_t copy = slot;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&sequence, __ATOMIC_RELAXED) == before) {
+            *state   = copy;
+            consumed = before;
+            return true;
+        }
+    }
+}
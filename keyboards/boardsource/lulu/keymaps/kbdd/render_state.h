@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Everything the OLED widgets read, captured in one place so rendering never
+// touches live keyboard state.
+//
+// The channel is built for a renderer on the RP2040's second core, but in
+// this keymap producer and consumer both run on core0 (housekeeping and
+// oled_task), so there is no dual-core gain here; it only decouples the
+// widgets from live state.
+typedef struct {
+    uint8_t  layer;
+    uint8_t  mods;  // get_mods() | get_oneshot_mods()
+    uint16_t wpm;
+    uint16_t wpm_avg;
+    uint32_t clock; // local time in seconds, 0 until synced
+} render_state_t;
+
+// Producer side: snapshot the keyboard and publish it if anything changed.
+// The newest snapshot always replaces the previous one.
+void render_state_capture(render_state_t *state);
+void render_state_publish(void);
+
+// Consumer side: copy the newest snapshot into *state. Returns true if one
+// was published since the last call.
+bool render_state_consume(render_state_t *state);
@@ -1,4 +1,4 @@
-SRC += anim.c progmem_anim.c progmem_horizon.c
+SRC += anim.c progmem_atlas.c progmem_horizon.c boot_timing.c render_state.c event_bus.c compact_anim.c anim_clock.c widget_watchdog.c game_profile.c encoder_feedback.c key_queue.c macro_seq.c packed_string.c indicator_fade.c gamma_lut.c keymap_cache.c host_link.c unicode_batch.c snippets.c snippet_trie.c macro_rec.c settings.c fb_capture.c
 
 CONVERT_TO=blok
 RAW_ENABLE = yes
@@ -10,6 +10,7 @@ WPM_ENABLE = yes
 CAPS_WORD_ENABLE = yes
 OLED_ENABLE = yes
 TAP_DANCE_ENABLE = yes
+DEFERRED_EXEC_ENABLE = yes
 COMBO_ENABLE = no
 TRI_LAYER_ENABLE = yes
 
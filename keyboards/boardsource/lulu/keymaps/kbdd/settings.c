@@ -0,0 +1,219 @@
+/**
+ * @file settings.c
+ * @brief Persisted runtime settings with raw HID get/set
+ *
+ * Stored as a version byte followed by the values. A block from another
+ * version, or with a value out of range, is replaced with the defaults.
+ * Writes block the main loop, and on the RP2040 a wear-levelling
+ * consolidation can take tens of milliseconds, so they wait until nothing
+ * has been typed for SETTINGS_SAVE_IDLE_MS rather than land mid-word.
+ */
+
+#include "settings.h"
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#endif
+#ifdef SPLIT_KEYBOARD
+#    include "transactions.h"
+#endif
+
+#ifndef ANIM_FRAME_MS
+#    define ANIM_FRAME_MS 80
+#endif
+#ifndef SLUG_LOCK_TIMEOUT
+#    define SLUG_LOCK_TIMEOUT 3000
+#endif
+#ifndef OLED_TIMEOUT
+#    define OLED_TIMEOUT 15000
+#endif
+#ifndef LUMINO_SOON_TIMEOUT
+#    define LUMINO_SOON_TIMEOUT 15000
+#endif
+#ifndef LUMINO_LONG_TIMEOUT
+#    define LUMINO_LONG_TIMEOUT 60000
+#endif
+#ifndef LUMINO_TRANSITION
+#    define LUMINO_TRANSITION 500
+#endif
+
+// Bump when the layout of settings_t changes
+#define SETTINGS_VERSION 1
+
+typedef struct {
+    uint8_t    version;
+    settings_t settings;
+} settings_block_t;
+
+_Static_assert(sizeof(settings_block_t) <= EECONFIG_USER_DATA_SIZE, "EECONFIG_USER_DATA_SIZE too small for the settings block");
+
+#define SETTINGS_DEFAULTS                            \
+    {                                                \
+        .anim_frame_ms        = ANIM_FRAME_MS,       \
+        .slug_lock_ms         = SLUG_LOCK_TIMEOUT,   \
+        .oled_timeout_ms      = OLED_TIMEOUT,        \
+        .lumino_soon_ms       = LUMINO_SOON_TIMEOUT, \
+        .lumino_long_ms       = LUMINO_LONG_TIMEOUT, \
+        .lumino_transition_ms = LUMINO_TRANSITION,   \
+    }
+
+settings_t settings = SETTINGS_DEFAULTS;
+
+static const settings_t PROGMEM defaults = SETTINGS_DEFAULTS;
+
+// Inclusive limits; keep frames from starving the loop and fades from
+// dividing by zero
+static const uint16_t PROGMEM limits[SETTING_COUNT][2] = {
+    [SETTING_ANIM_FRAME_MS]        = {16, 1000},
+    [SETTING_SLUG_LOCK_MS]         = {250, UINT16_MAX},
+    [SETTING_OLED_TIMEOUT_MS]      = {1000, UINT16_MAX},
+    [SETTING_LUMINO_SOON_MS]       = {1000, UINT16_MAX},
+    [SETTING_LUMINO_LONG_MS]       = {1000, UINT16_MAX},
+    [SETTING_LUMINO_TRANSITION_MS] = {1, 5000},
+};
+
+static bool setting_valid(uint8_t id, uint16_t value) {
+    return id < SETTING_COUNT && value >= pgm_read_word(&limits[id][0]) && value <= pgm_read_word(&limits[id][1]);
+}
+
+static bool save_pending = false;
+
+static void settings_save(void) {
+    settings_block_t block = {.version = SETTINGS_VERSION, .settings = settings};
+    eeconfig_update_user_datablock(&block, 0, sizeof(block));
+}
+
+static void settings_load_defaults(void) {
+    memcpy_P(&settings, &defaults, sizeof(settings));
+}
+
+#ifdef SPLIT_KEYBOARD
+typedef struct {
+    bool       save;
+    settings_t settings;
+} settings_sync_t;
+
+static bool sync_pending = false;
+static bool sync_save    = false;
+
+static void settings_slave_handler(uint8_t in_buflen, const void *in_data, uint8_t out_buflen, void *out_data) {
+    if (in_buflen < sizeof(settings_sync_t)) {
+        return;
+    }
+
+    const settings_sync_t *sync = in_data;
+    settings                    = sync->settings;
+    // Kept on the slave too, for when it is plugged in on its own
+    if (sync->save) {
+        save_pending = true;
+    }
+}
+#endif
+
+static void settings_changed(bool save) {
+    if (save) {
+        save_pending = true;
+    }
+#ifdef SPLIT_KEYBOARD
+    sync_pending = true;
+    sync_save |= save;
+#endif
+}
+
+void settings_init(void) {
+    settings_block_t block;
+    eeconfig_read_user_datablock(&block, 0, sizeof(block));
+
+    bool valid = block.version == SETTINGS_VERSION;
+    for (uint8_t i = 0; valid && i < SETTING_COUNT; i++) {
+        valid = setting_valid(i, block.settings.values[i]);
+    }
+
+    if (valid) {
+        settings = block.settings;
+    } else {
+        settings_load_defaults();
+        save_pending = true;
+    }
+
+#ifdef SPLIT_KEYBOARD
+    transaction_register_rpc(SETTINGS_SYNC, settings_slave_handler);
+    // The halves can have different blocks; the master's wins for this
+    // session, and reaches the slave's EEPROM only on an explicit SAVE
+    sync_pending = is_keyboard_master();
+    sync_save    = false;
+#endif
+}
+
+void settings_task(void) {
+    if (save_pending && last_input_activity_elapsed() >= SETTINGS_SAVE_IDLE_MS) {
+        settings_save();
+        save_pending = false;
+    }
+
+#ifdef SPLIT_KEYBOARD
+    if (!sync_pending || !is_keyboard_master()) {
+        return;
+    }
+
+    settings_sync_t sync = {.save = sync_save, .settings = settings};
+    if (transaction_rpc_send(SETTINGS_SYNC, sizeof(sync), &sync)) {
+        sync_pending = false;
+        sync_save    = false;
+    }
+#endif
+}
+
+#ifdef RAW_ENABLE
+enum {
+    SETTINGS_OP_GET,
+    SETTINGS_OP_SET,
+    SETTINGS_OP_SAVE,
+    SETTINGS_OP_DEFAULTS,
+};
+
+enum {
+    SETTINGS_OK,
+    SETTINGS_BAD_ID,
+    SETTINGS_OUT_OF_RANGE,
+};
+
+// Request: 'S', op, [id, value (u16)]. Response: 'S', status, count, then
+// every value as u16. Big-endian. SET and DEFAULTS apply at once but are
+// only kept across a power cycle after SAVE, which is written once the
+// keyboard is idle.
+void settings_raw_hid(uint8_t *data, uint8_t length) {
+    uint8_t status = SETTINGS_OK;
+
+    switch (data[1]) {
+        case SETTINGS_OP_SET: {
+            uint8_t  id    = data[2];
+            uint16_t value = (uint16_t)data[3] << 8 | data[4];
+            if (id >= SETTING_COUNT) {
+                status = SETTINGS_BAD_ID;
+            } else if (!setting_valid(id, value)) {
+                status = SETTINGS_OUT_OF_RANGE;
+            } else {
+                settings.values[id] = value;
+                settings_changed(false);
+            }
+            break;
+        }
+        case SETTINGS_OP_SAVE:
+            settings_changed(true);
+            break;
+        case SETTINGS_OP_DEFAULTS:
+            settings_load_defaults();
+            settings_changed(false);
+            break;
+    }
+
+    memset(&data[1], 0, length - 1);
+    data[1] = status;
+    data[2] = SETTING_COUNT;
+    for (uint8_t i = 0; i < SETTING_COUNT; i++) {
+        data[3 + i * 2] = (uint8_t)(settings.values[i] >> 8);
+        data[4 + i * 2] = (uint8_t)settings.values[i];
+    }
+    raw_hid_send(data, length);
+}
+#endif
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include QMK_KEYBOARD_H
+
+// Timing parameters that can be tuned from the host without a reflash. The
+// config.h values are the defaults; the block lives in the EEPROM user
+// datablock and is read into RAM once at init, so the code using them does a
+// plain load. The master sends changes to the slave over SETTINGS_SYNC.
+typedef enum {
+    SETTING_ANIM_FRAME_MS,
+    SETTING_SLUG_LOCK_MS,
+    SETTING_OLED_TIMEOUT_MS,
+    SETTING_LUMINO_SOON_MS,
+    SETTING_LUMINO_LONG_MS,
+    SETTING_LUMINO_TRANSITION_MS,
+    SETTING_COUNT,
+} setting_id_t;
+
+typedef union {
+    struct {
+        uint16_t anim_frame_ms;
+        uint16_t slug_lock_ms;
+        uint16_t oled_timeout_ms;
+        uint16_t lumino_soon_ms;
+        uint16_t lumino_long_ms;
+        uint16_t lumino_transition_ms;
+    };
+    uint16_t values[SETTING_COUNT];
+} settings_t;
+
+extern settings_t settings;
+
+#define SETTINGS_HID_COMMAND 'S'
+
+// Quiet time before a pending save is written to EEPROM
+#ifndef SETTINGS_SAVE_IDLE_MS
+#    define SETTINGS_SAVE_IDLE_MS 1000
+#endif
+
+void settings_init(void);
+void settings_task(void);
+
+void settings_raw_hid(uint8_t *data, uint8_t length);
@@ -0,0 +1,53 @@
+// Generated by build_snippets.py from snippets.txt, do not edit.
+
+#include QMK_KEYBOARD_H
+#include "snippet_trie.h"
+
+const uint8_t PROGMEM snippet_symbol[SNIPPET_KEYCODE_LIMIT] = {
+     0,  0,  0,  0,  2,  3,  0,  4,  5,  0,  6,  0,  7,  0,  0,  8,
+     9,  0, 10, 11,  0, 12,  0, 13,  0,  0,  0,  0, 14,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  1,  0,  0,  0,  0,  0,
+};
+
+const snippet_node_t PROGMEM snippet_trie[SNIPPET_NODE_COUNT] = {
+    {0x0000, 0xFFFF},
+    {0x0000, 0x0000},
+    {0x000A, 0x000E},
+    {0x0000, 0x0001},
+    {0x000A, 0x000F},
+    {0x0000, 0x0001},
+    {0x8004, 0x0005},
+    {0x0004, 0x0001},
+    {0x0004, 0x0001},
+    {0x8005, 0x0007},
+    {0x0003, 0x0008},
+    {0x0001, 0x0001},
+    {0x8003, 0x0003},
+    {0x0005, 0x0001},
+    {0x0000, 0x000B},
+    {0x0000, 0x000D},
+    {0x0008, 0x000A},
+    {0x8000, 0x0010},
+    {0x8001, 0x0002},
+    {0x8002, 0x000D},
+    {0x8006, 0x0004},
+};
+
+static const char PROGMEM snippet_0[] = "\b\b\b\bLGTM, thanks!"; // ;lgtm
+static const char PROGMEM snippet_1[] = "\b\b\b\bPTAL when you get a chance."; // ;ptal
+static const char PROGMEM snippet_2[] = "\b\bThank you!"; // ;ty
+static const char PROGMEM snippet_3[] = "\b\bBest regards,\n"; // ;br
+static const char PROGMEM snippet_4[] = "\b\be.g."; // ;eg
+static const char PROGMEM snippet_5[] = "\b\bi.e."; // ;ie
+static const char PROGMEM snippet_6[] = "\b\b\b\b// TODO:"; // ;todo
+
+const char *const PROGMEM snippet_text[] = {
+    snippet_0,
+    snippet_1,
+    snippet_2,
+    snippet_3,
+    snippet_4,
+    snippet_5,
+    snippet_6,
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+// Generated by build_snippets.py from snippets.txt, do not edit.
+
+#include QMK_KEYBOARD_H
+
+#define SNIPPET_NODE_COUNT 21
+#define SNIPPET_KEYCODE_LIMIT 0x39
+#define SNIPPET_NO_CHECK 0xFFFF
+#define SNIPPET_LEAF 0x8000
+
+typedef struct {
+    uint16_t base; // children at base + symbol; SNIPPET_LEAF | snippet for leaves
+    uint16_t check; // parent node
+} snippet_node_t;
+
+extern const uint8_t PROGMEM        snippet_symbol[SNIPPET_KEYCODE_LIMIT];
+extern const snippet_node_t PROGMEM snippet_trie[SNIPPET_NODE_COUNT];
+extern const char *const PROGMEM    snippet_text[];
@@ -0,0 +1,78 @@
+/**
+ * @file snippets.c
+ * @brief Abbreviation matching on a double-array trie
+ *
+ * A transition is base[state] + symbol, valid if that node's check is the
+ * state it came from. A miss retries once from the root, so abbreviations
+ * are found after any other text, at most two lookups per key.
+ */
+
+#include "snippets.h"
+#include "snippet_trie.h"
+#include "packed_string.h"
+
+#define SNIPPET_ROOT 0
+#define SNIPPET_NONE 0xFFFF
+
+static uint16_t state = SNIPPET_ROOT;
+
+static uint16_t snippet_step(uint16_t from, uint8_t symbol) {
+    uint16_t next = pgm_read_word(&snippet_trie[from].base) + symbol;
+    if (next < SNIPPET_NODE_COUNT && pgm_read_word(&snippet_trie[next].check) == from) {
+        return next;
+    }
+    return SNIPPET_NONE;
+}
+
+// A modifier or layer key on its own types nothing, so it leaves the match
+// where it is; Shift between letters in particular must not reset it
+static bool snippet_transparent(uint16_t keycode) {
+    return IS_MODIFIER_KEYCODE(keycode) || IS_QK_ONE_SHOT_MOD(keycode) || IS_QK_LAYER_MOD(keycode) || IS_QK_TO(keycode)
+           || IS_QK_MOMENTARY(keycode) || IS_QK_DEF_LAYER(keycode) || IS_QK_TOGGLE_LAYER(keycode)
+           || IS_QK_ONE_SHOT_LAYER(keycode) || IS_QK_LAYER_TAP_TOGGLE(keycode)
+#ifdef TRI_LAYER_ENABLE
+           || keycode == QK_TRI_LAYER_LOWER || keycode == QK_TRI_LAYER_UPPER
+#endif
+        ;
+}
+
+bool snippets_process(uint16_t keycode, keyrecord_t *record) {
+    if (!record->event.pressed) {
+        return true;
+    }
+
+    if (IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode)) {
+        if (record->tap.count == 0) {
+            return true; // held as a modifier or layer, not typed
+        }
+        keycode &= 0xFF;
+    }
+
+    if (snippet_transparent(keycode)) {
+        return true;
+    }
+
+    uint8_t symbol = 0;
+    if (keycode < SNIPPET_KEYCODE_LIMIT && !((get_mods() | get_oneshot_mods()) & ~MOD_MASK_SHIFT)) {
+        symbol = pgm_read_byte(&snippet_symbol[keycode]);
+    }
+    if (symbol == 0) {
+        state = SNIPPET_ROOT;
+        return true;
+    }
+
+    uint16_t next = snippet_step(state, symbol);
+    if (next == SNIPPET_NONE && state != SNIPPET_ROOT) {
+        next = snippet_step(SNIPPET_ROOT, symbol);
+    }
+    state = next == SNIPPET_NONE ? SNIPPET_ROOT : next;
+
+    uint16_t base = pgm_read_word(&snippet_trie[state].base);
+    if (state == SNIPPET_ROOT || !(base & SNIPPET_LEAF)) {
+        return true;
+    }
+
+    // Swallow the last key; the expansion starts with backspaces for the rest
+    state = SNIPPET_ROOT;
+    return !packed_string_send((const char *)pgm_read_ptr(&snippet_text[base & ~SNIPPET_LEAF]));
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <stdbool.h>
+#include QMK_KEYBOARD_H
+
+// Text expansion: typing an abbreviation from snippets.txt replaces it with
+// its expansion. Keystrokes walk a PROGMEM trie one node at a time, so the
+// cost per key does not depend on the number of snippets. Matching ignores
+// Shift, and modifier and layer keys pressed on their own leave it where it
+// is; any other key that is not part of an abbreviation (space, backspace, a
+// chord with Ctrl/Alt/GUI) starts over. Regenerate snippet_trie.c with build_snippets.py.
+
+// From process_record_user(); returns false when the key completed an
+// abbreviation and the expansion was started.
+bool snippets_process(uint16_t keycode, keyrecord_t *record);
@@ -0,0 +1,44 @@
+#pragma once
+
+// Split state that QMK can mirror from the master to the slave. config.h
+// lists every consumer and what it reads in SPLIT_SYNC_READERS; the slave
+// rows are folded into SPLIT_SLAVE_READS here, and each SPLIT_*_ENABLE flag
+// follows from its bit, so only what the slave reads crosses the link.
+#define SYNC_LAYER (1 << 0)
+#define SYNC_WPM (1 << 1)
+#define SYNC_ACTIVITY (1 << 2)
+#define SYNC_MODS (1 << 3)
+
+// Payload of each one's transaction in QMK's transactions.c, sent on every
+// change and again at least every FORCED_SYNC_THROTTLE_MS (100 ms default)
+#define SYNC_LAYER_BYTES 8     // layer and default layer, 32-bit layer_state_t
+#define SYNC_WPM_BYTES 1       // current WPM
+#define SYNC_ACTIVITY_BYTES 12 // matrix, encoder and pointing device timestamps
+#define SYNC_MODS_BYTES 4      // real, weak, oneshot and locked oneshot mods
+
+#define SPLIT_SYNC_STR(x) #x
+#define SPLIT_SYNC_XSTR(x) SPLIT_SYNC_STR(x)
+
+#ifndef SPLIT_SYNC_READERS
+#    error "config.h must define SPLIT_SYNC_READERS before including split_sync.h"
+#endif
+
+#define SPLIT_SYNC_HALF_MASTER 0
+#define SPLIT_SYNC_HALF_SLAVE 1
+#define SPLIT_SYNC_SLAVE_ROW(half, consumer, reads) | (SPLIT_SYNC_HALF_##half ? (reads) : 0)
+#define SPLIT_SLAVE_READS (0 SPLIT_SYNC_READERS(SPLIT_SYNC_SLAVE_ROW))
+
+#ifdef SPLIT_KEYBOARD
+#    if SPLIT_SLAVE_READS & SYNC_LAYER
+#        define SPLIT_LAYER_STATE_ENABLE
+#    endif
+#    if SPLIT_SLAVE_READS & SYNC_WPM
+#        define SPLIT_WPM_ENABLE
+#    endif
+#    if SPLIT_SLAVE_READS & SYNC_ACTIVITY
+#        define SPLIT_ACTIVITY_ENABLE
+#    endif
+#    if SPLIT_SLAVE_READS & SYNC_MODS
+#        define SPLIT_MODS_ENABLE
+#    endif
+#endif
@@ -0,0 +1,127 @@
+/**
+ * @file unicode_batch.c
+ * @brief Batched Unicode output through the host companion
+ *
+ * Payload after [command, seq]: a count, then big-endian 24-bit code
+ * points, as many as fit the host_link payload.
+ *
+ * Keys that come after a batch never overtake it. Normally the key queue is
+ * already held by the request in flight; if a batch has to wait for the link
+ * without that, it takes a hold of its own until it is sent.
+ */
+
+#include "unicode_batch.h"
+#include "host_link.h"
+#include "key_queue.h"
+
+#if defined(UNICODE_HOST_ENABLE) && defined(UNICODEMAP_ENABLE) && defined(RAW_ENABLE)
+
+#    define UNICODE_BATCH_MAX ((HOST_LINK_PAYLOAD_SIZE - 1) / 3)
+
+_Static_assert(1 + UNICODE_BATCH_MAX * 3 <= HOST_LINK_PAYLOAD_SIZE, "unicode batch does not fit a host_link report");
+
+static uint32_t batch[UNICODE_BATCH_MAX];
+static uint8_t  batch_count = 0;
+
+// The batch handed to host_link, kept for the fallback
+static uint32_t sent[UNICODE_BATCH_MAX];
+static uint8_t  sent_count = 0;
+
+static void unicode_batch_fallback(void) {
+    for (uint8_t i = 0; i < sent_count; i++) {
+        register_unicode(sent[i]);
+    }
+}
+
+static deferred_token flush_token = INVALID_DEFERRED_TOKEN;
+static bool           batch_held  = false;
+
+static bool unicode_batch_send(void) {
+    // The previous batch may still need its fallback
+    if (host_link_busy()) {
+        return false;
+    }
+
+    uint8_t payload[1 + UNICODE_BATCH_MAX * 3];
+
+    payload[0] = batch_count;
+    for (uint8_t i = 0; i < batch_count; i++) {
+        payload[1 + i * 3] = (uint8_t)(batch[i] >> 16);
+        payload[2 + i * 3] = (uint8_t)(batch[i] >> 8);
+        payload[3 + i * 3] = (uint8_t)batch[i];
+    }
+
+    memcpy(sent, batch, batch_count * sizeof(batch[0]));
+    sent_count = batch_count;
+
+    // host_link holds the key queue until the batch is typed
+    host_link_request(UNICODE_BATCH_HID_COMMAND, payload, 1 + batch_count * 3, NULL, unicode_batch_fallback);
+    batch_count = 0;
+
+    if (batch_held) {
+        batch_held = false;
+        key_queue_release();
+    }
+    return true;
+}
+
+static uint32_t unicode_batch_flush(uint32_t trigger_time, void *cb_arg) {
+    if (!unicode_batch_send()) {
+        return 1; // another request in flight; try again next tick
+    }
+    flush_token = INVALID_DEFERRED_TOKEN;
+    return 0;
+}
+
+// If the link is busy the deferred flush keeps retrying, and the key that
+// asked for the flush is queued behind the batch.
+static void unicode_batch_flush_now(void) {
+    if (flush_token == INVALID_DEFERRED_TOKEN) {
+        return;
+    }
+    if (unicode_batch_send()) {
+        cancel_deferred_exec(flush_token);
+        flush_token = INVALID_DEFERRED_TOKEN;
+    } else if (!batch_held) {
+        batch_held = true;
+        key_queue_hold();
+    }
+}
+
+bool unicode_batch_process(uint16_t keycode, keyrecord_t *record) {
+    if (!IS_EVENT(record->event) || !record->event.pressed) {
+        return true;
+    }
+
+    if (!IS_QK_UNICODEMAP(keycode) && !IS_QK_UNICODEMAP_PAIR(keycode)) {
+        // Any other key goes out after the code points typed before it
+        unicode_batch_flush_now();
+        return true;
+    }
+
+    // Behind a running macro, or with no companion, QMK types it as before
+    if (key_queue_holding() || (batch_count == 0 && !host_link_available())) {
+        return true;
+    }
+    if (batch_count == UNICODE_BATCH_MAX) {
+        unicode_batch_flush_now();
+        if (batch_count) {
+            return true; // into the key queue, behind the batch
+        }
+    }
+
+    if (batch_count == 0) {
+        flush_token = defer_exec(UNICODE_BATCH_WINDOW_MS, unicode_batch_flush, NULL);
+        if (flush_token == INVALID_DEFERRED_TOKEN) {
+            return true;
+        }
+    }
+    batch[batch_count++] = unicodemap_get_code_point(unicodemap_index(keycode));
+    return false;
+}
+
+#else
+bool unicode_batch_process(uint16_t keycode, keyrecord_t *record) {
+    return true;
+}
+#endif
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include QMK_KEYBOARD_H
+
+// Sends UM()/UP() code points to the host companion in batches over raw HID
+// instead of typing each one as a WinCompose sequence. Code points pressed
+// within UNICODE_BATCH_WINDOW_MS of each other share a report. Without an
+// acknowledgement the batch is typed with register_unicode() in the
+// configured UNICODE_SELECTED_MODES, and while the companion is presumed
+// absent the keycodes are left to QMK as before.
+#ifndef UNICODE_BATCH_WINDOW_MS
+#    define UNICODE_BATCH_WINDOW_MS 10
+#endif
+
+#define UNICODE_BATCH_HID_COMMAND 'U'
+
+// From pre_process_record_user(); returns false if the keycode was taken.
+bool unicode_batch_process(uint16_t keycode, keyrecord_t *record);
@@ -0,0 +1,223 @@
+/**
+ * @file widget_watchdog.c
+ * @brief Per-widget render timing and quality degradation
+ *
+ * Each widget's draw is timed in microseconds. On the RP2040 that is the
+ * 1 MHz system timer behind port_rt_get_counter_value(); elsewhere it falls
+ * back to milliseconds, which only sees overruns a whole millisecond over
+ * budget. Flushing is left to oled_task(), which sends at most
+ * OLED_UPDATE_PROCESS_LIMIT blocks a pass, so bus time never blocks the
+ * main loop for a whole screen.
+ */
+
+#include "widget_watchdog.h"
+#include "anim.h"
+#include "oled_utils.h"
+#ifdef SPLIT_KEYBOARD
+#    include "transactions.h"
+#endif
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#endif
+
+#if defined(MCU_RP) && defined(PROTOCOL_CHIBIOS)
+#    define widget_clock_us() ((uint32_t)port_rt_get_counter_value())
+#else
+#    define widget_clock_us() (timer_read32() * 1000)
+#endif
+
+typedef struct {
+    uint8_t x, y, w, h;
+} widget_rect_t;
+
+// What the host sees of a widget, also what the slave sends back for its own
+typedef struct {
+    uint8_t  level;
+    uint8_t  strikes;
+    uint16_t worst_us;
+    uint16_t overruns;
+} widget_stats_t;
+
+typedef struct {
+    widget_stats_t stats;
+    uint8_t        frame;
+    uint32_t       changed_at;
+    uint32_t       last_overrun;
+} widget_watch_t;
+
+// Regions cleared when a widget is hidden; they match the layout in anim.c.
+// The WPM bar (WPM_BAR_X/Y in config.h) is drawn by the WPM widget inside
+// the boot frame, so STATUS owns everything around it.
+static const widget_rect_t widget_rects[WIDGET_COUNT][4] = {
+    [WIDGET_STATUS]  = {{0, 0, 128, 17}, {0, 17, 108, 5}, {127, 17, 1, 5}, {0, 22, 106, 10}},
+    [WIDGET_WPM]     = {{106, 22, 22, 10}, {108, 17, 19, 5}},
+    [WIDGET_HORIZON] = {{0, 0, 128, 32}},
+    [WIDGET_CLOCK]   = {{80, 5, 48, 8}},
+};
+
+static const uint16_t widget_budget_us[WIDGET_COUNT] = {
+    [WIDGET_STATUS]  = WIDGET_SCREEN_RENDER_BUDGET_US,
+    [WIDGET_WPM]     = WIDGET_RENDER_BUDGET_US,
+    [WIDGET_HORIZON] = WIDGET_SCREEN_RENDER_BUDGET_US,
+    [WIDGET_CLOCK]   = WIDGET_RENDER_BUDGET_US,
+};
+
+// Drawn by the slave, so the master asks it for their stats
+#define WIDGET_SLAVE_MASK ((1 << WIDGET_HORIZON) | (1 << WIDGET_CLOCK))
+
+static widget_watch_t widgets[WIDGET_COUNT];
+
+static void widget_set_level(widget_watch_t *widget, uint8_t level, uint32_t now) {
+    widget->stats.level   = level;
+    widget->stats.strikes = 0;
+    widget->frame         = 0;
+    widget->changed_at    = now;
+}
+
+// The WPM bar only redraws the columns that changed, so anything that
+// clears or stops maintaining its region has to make it start over.
+static void widget_invalidate(widget_id_t id) {
+#ifdef WPM_BAR_ENABLE
+    for (uint8_t i = 0; i < ARRAY_SIZE(widget_rects[id]); i++) {
+        const widget_rect_t *rect = &widget_rects[id][i];
+        if (rect->w && rect->x < WPM_BAR_X + WPM_BAR_WIDTH && WPM_BAR_X < rect->x + rect->w && rect->y < WPM_BAR_Y + WPM_BAR_HEIGHT && WPM_BAR_Y < rect->y + rect->h) {
+            wpm_bar_invalidate();
+            return;
+        }
+    }
+#endif
+}
+
+static void widget_erase(widget_id_t id) {
+    for (uint8_t i = 0; i < ARRAY_SIZE(widget_rects[id]); i++) {
+        const widget_rect_t *rect = &widget_rects[id][i];
+        if (rect->w) {
+            clear_rect(rect->x, rect->y, rect->w, rect->h);
+        }
+    }
+    widget_invalidate(id);
+}
+
+widget_level_t widget_level(widget_id_t id) {
+    return widgets[id].stats.level;
+}
+
+bool widget_run(widget_id_t id, widget_draw_fn_t draw, const render_state_t *state) {
+    widget_watch_t *widget = &widgets[id];
+    widget_stats_t *stats  = &widget->stats;
+    uint32_t        now    = timer_read32();
+
+    // Recovery is by probing: after a quiet timeout step up one level and
+    // let the next overruns, if any, push it back down.
+    if (stats->level != WIDGET_LEVEL_FULL && TIMER_DIFF_32(now, widget->changed_at) >= WIDGET_WATCHDOG_TIMEOUT_MS && TIMER_DIFF_32(now, widget->last_overrun) >= WIDGET_WATCHDOG_TIMEOUT_MS) {
+        if (stats->level == WIDGET_LEVEL_HIDDEN) {
+            widget_invalidate(id);
+        }
+        widget_set_level(widget, stats->level - 1, now);
+    }
+
+    switch (stats->level) {
+        case WIDGET_LEVEL_REDUCED:
+            if (widget->frame++ % WIDGET_REDUCED_DIVIDER) {
+                return false;
+            }
+            break;
+        case WIDGET_LEVEL_STATIC:
+            return false;
+        case WIDGET_LEVEL_HIDDEN:
+            if (widget->frame == 0) {
+                widget->frame = 1;
+                widget_erase(id);
+            }
+            return false;
+    }
+
+    uint32_t start = widget_clock_us();
+    draw(state);
+    uint32_t elapsed = widget_clock_us() - start;
+
+    if (elapsed > stats->worst_us) {
+        stats->worst_us = elapsed > UINT16_MAX ? UINT16_MAX : (uint16_t)elapsed;
+    }
+
+    if (elapsed > widget_budget_us[id]) {
+        widget->last_overrun = now;
+        if (stats->overruns < UINT16_MAX) {
+            stats->overruns++;
+        }
+        if (++stats->strikes >= WIDGET_WATCHDOG_STRIKES && stats->level < WIDGET_LEVEL_HIDDEN && TIMER_DIFF_32(now, widget->changed_at) >= WIDGET_WATCHDOG_GRACE_MS) {
+            widget_set_level(widget, stats->level + 1, now);
+        }
+    } else if (stats->strikes && TIMER_DIFF_32(now, widget->last_overrun) >= WIDGET_WATCHDOG_TIMEOUT_MS) {
+        stats->strikes = 0;
+    }
+
+    return true;
+}
+
+typedef struct {
+    uint16_t       dropped;
+    widget_stats_t stats[WIDGET_COUNT];
+} widget_report_t;
+
+static void widget_report_fill(widget_report_t *report) {
+    report->dropped = anim_dropped_frames();
+    for (uint8_t i = 0; i < WIDGET_COUNT; i++) {
+        report->stats[i] = widgets[i].stats;
+    }
+}
+
+#ifdef SPLIT_KEYBOARD
+#    ifdef RPC_S2M_BUFFER_SIZE
+_Static_assert(sizeof(widget_report_t) <= RPC_S2M_BUFFER_SIZE, "WIDGET_WATCHDOG_SYNC report larger than the split RPC buffer");
+#    endif
+
+static void widget_watchdog_slave_handler(uint8_t in_buflen, const void *in_data, uint8_t out_buflen, void *out_data) {
+    if (out_buflen >= sizeof(widget_report_t)) {
+        widget_report_fill(out_data);
+    }
+}
+#endif
+
+void widget_watchdog_init(void) {
+#ifdef SPLIT_KEYBOARD
+    transaction_register_rpc(WIDGET_WATCHDOG_SYNC, widget_watchdog_slave_handler);
+#endif
+}
+
+#ifdef RAW_ENABLE
+// Response: 'W', widget count, dropped animation frames on the master (u16),
+// then per widget: level, strikes, worst render us (u16), overruns (u16),
+// then dropped animation frames on the slave (u16). Big-endian. Slave
+// widgets read as zero if the slave did not answer.
+void widget_watchdog_raw_hid(uint8_t *data, uint8_t length) {
+    widget_report_t master, slave = {0};
+    widget_report_fill(&master);
+#    ifdef SPLIT_KEYBOARD
+    transaction_rpc_exec(WIDGET_WATCHDOG_SYNC, 0, NULL, sizeof(slave), &slave);
+#    endif
+
+    memset(&data[1], 0, length - 1);
+    data[1] = WIDGET_COUNT;
+    data[2] = (uint8_t)(master.dropped >> 8);
+    data[3] = (uint8_t)master.dropped;
+
+    uint8_t *out = &data[4];
+    for (uint8_t i = 0; i < WIDGET_COUNT; i++, out += 6) {
+        const widget_stats_t *stats = (WIDGET_SLAVE_MASK & (1 << i)) ? &slave.stats[i] : &master.stats[i];
+
+        out[0] = stats->level;
+        out[1] = stats->strikes;
+        out[2] = (uint8_t)(stats->worst_us >> 8);
+        out[3] = (uint8_t)stats->worst_us;
+        out[4] = (uint8_t)(stats->overruns >> 8);
+        out[5] = (uint8_t)stats->overruns;
+    }
+    out[0] = (uint8_t)(slave.dropped >> 8);
+    out[1] = (uint8_t)slave.dropped;
+
+    raw_hid_send(data, length);
+}
+
+_Static_assert(4 + WIDGET_COUNT * 6 + 2 <= RAW_EPSIZE, "'W' response does not fit a raw HID report");
+#endif
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include QMK_KEYBOARD_H
+#include "render_state.h"
+
+// Render budget enforcement for the OLED widgets. Each widget is timed; one
+// that keeps overrunning its budget steps down a quality level, and steps back
+// up once WIDGET_WATCHDOG_TIMEOUT_MS passes without an overrun.
+typedef enum {
+    WIDGET_STATUS,  // boot, layer and modifier sprites (master)
+    WIDGET_WPM,     // WPM digits and bar (master)
+    WIDGET_HORIZON, // horizon loop (slave)
+    WIDGET_CLOCK,   // clock (slave)
+    WIDGET_COUNT,
+} widget_id_t;
+
+typedef enum {
+    WIDGET_LEVEL_FULL,    // every frame
+    WIDGET_LEVEL_REDUCED, // every WIDGET_REDUCED_DIVIDER-th frame
+    WIDGET_LEVEL_STATIC,  // last drawn frame stays on screen
+    WIDGET_LEVEL_HIDDEN,  // region cleared once, then left blank
+} widget_level_t;
+
+// Budgets cover the draw into the framebuffer. Flushing it is oled_task()'s
+// job, rate-limited by OLED_UPDATE_PROCESS_LIMIT, and not charged to the
+// widget. Widgets that repaint most of the screen get the larger budget.
+#ifndef WIDGET_RENDER_BUDGET_US
+#    define WIDGET_RENDER_BUDGET_US 1000
+#endif
+
+#ifndef WIDGET_SCREEN_RENDER_BUDGET_US
+#    define WIDGET_SCREEN_RENDER_BUDGET_US 5000
+#endif
+
+// Overruns needed, at least WIDGET_WATCHDOG_GRACE_MS after the last level
+// change, before a widget steps down
+#ifndef WIDGET_WATCHDOG_STRIKES
+#    define WIDGET_WATCHDOG_STRIKES 3
+#endif
+
+#ifndef WIDGET_REDUCED_DIVIDER
+#    define WIDGET_REDUCED_DIVIDER 4
+#endif
+
+#define WIDGET_WATCHDOG_HID_COMMAND 'W'
+
+typedef void (*widget_draw_fn_t)(const render_state_t *state);
+
+// Draws the widget if its level allows it this frame. Returns true if it
+// drew.
+bool           widget_run(widget_id_t id, widget_draw_fn_t draw, const render_state_t *state);
+widget_level_t widget_level(widget_id_t id);
+
+void widget_watchdog_init(void);
+void widget_watchdog_raw_hid(uint8_t *data, uint8_t length);
@@ -0,0 +1,480 @@
+import argparse
+import collections
+import os
+import shutil
+import struct
+import subprocess
+import sys
+import time
+import urllib.parse
+import webbrowser
+import zlib
+
+from sync_clock import get_raw_hid_interface
+
+REPORT_SIZE = 32
+
+BOOT_STAMPS = [
+    "reset",
+    "post_init",
+    "clock_rpc",
+    "split_connected",
+    "usb_configured",
+    "first_scan",
+    "wake",
+]
+
+# settings.h, in setting_id_t order
+SETTINGS = [
+    "anim-frame-ms",
+    "slug-lock-ms",
+    "oled-timeout-ms",
+    "lumino-soon-ms",
+    "lumino-long-ms",
+    "lumino-transition-ms",
+]
+SETTINGS_OPS = {"show": 0, "set": 1, "save": 2, "defaults": 3}
+SETTINGS_STATUS = ["ok", "unknown setting", "out of range"]
+
+WIDGETS = ["status", "wpm", "horizon", "clock"]
+WIDGET_LEVELS = ["full", "reduced", "static", "hidden"]
+
+
+def request(interface, payload, timeout_ms=500):
+    # First byte is the report ID
+    packet = [0] * (REPORT_SIZE + 1)
+    packet[1 : 1 + len(payload)] = payload
+    interface.write(bytes(packet))
+
+    response = interface.read(REPORT_SIZE, timeout=timeout_ms)
+    if not response or response[0] != payload[0]:
+        return None
+    return response
+
+
+def be32(data, offset):
+    return (data[offset] << 24) | (data[offset + 1] << 16) | (data[offset + 2] << 8) | data[offset + 3]
+
+
+def boot_timing(interface, args):
+    response = request(interface, [ord("B"), 1 if args.previous else 0])
+    if response is None:
+        print("No boot timing response")
+        return 1
+
+    recorded = response[2]
+    print(f"Boot count: {response[3]}")
+
+    reset = be32(response, 4)
+    for i, name in enumerate(BOOT_STAMPS):
+        if not recorded & (1 << i):
+            print(f"{name:>16}: -")
+            continue
+
+        stamp = be32(response, 4 + i * 4)
+        print(f"{name:>16}: {stamp:>8} ms  (+{stamp - reset} ms)")
+    return 0
+
+
+def be16(data, offset):
+    return (data[offset] << 8) | data[offset + 1]
+
+
+def widgets(interface, args):
+    response = request(interface, [ord("W")])
+    if response is None:
+        print("No widget watchdog response")
+        return 1
+
+    count = min(response[1], len(WIDGETS))
+    slave_dropped = 4 + response[1] * 6
+    print(f"Dropped animation frames: master {be16(response, 2)}, slave {be16(response, slave_dropped)}")
+    for i in range(count):
+        level, strikes = response[4 + i * 6 : 6 + i * 6]
+        worst_us = be16(response, 6 + i * 6)
+        overruns = be16(response, 8 + i * 6)
+        print(f"{WIDGETS[i]:>8}: {WIDGET_LEVELS[level]:<8} worst {worst_us / 1000:>6.3f} ms  overruns {overruns:>5}  strikes {strikes}")
+    return 0
+
+
+def game_profile(interface, args):
+    response = request(interface, [ord("G")])
+    if response is None:
+        print("No game profile response")
+        return 1
+
+    print(f"Game profile: {'on' if response[1] else 'off'}")
+    print(f"  normal loop rate: {be32(response, 2):>7} /s")
+    print(f"  gaming loop rate: {be32(response, 6):>7} /s")
+    return 0
+
+
+def key_queue(interface, args):
+    response = request(interface, [ord("Q")])
+    if response is None:
+        print("No key queue response")
+        return 1
+
+    print(f"Key queue: {response[2]}/{response[1]} high water")
+    print(f"  queued:    {be16(response, 3):>5}")
+    print(f"  overflows: {be16(response, 5):>5}")
+    return 0
+
+
+def settings(interface, args):
+    payload = [ord("S"), SETTINGS_OPS[args.action]]
+    if args.action == "set":
+        if args.name not in SETTINGS or args.value is None:
+            print(f"Usage: settings set NAME VALUE, NAME one of {', '.join(SETTINGS)}")
+            return 1
+        payload += [SETTINGS.index(args.name), (args.value >> 8) & 0xFF, args.value & 0xFF]
+
+    response = request(interface, payload)
+    if response is None:
+        print("No settings response")
+        return 1
+
+    status = response[1]
+    if status:
+        print(f"Not changed: {SETTINGS_STATUS[status] if status < len(SETTINGS_STATUS) else status}")
+
+    for i in range(min(response[2], len(SETTINGS))):
+        print(f"{SETTINGS[i]:>20}: {be16(response, 3 + i * 2):>5}")
+    if args.action in ("set", "defaults") and not status:
+        print("Applied until power off; run 'settings save' to keep")
+    return 1 if status else 0
+
+
+# Framebuffer capture (fb_capture.h)
+FB_WIDTH, FB_HEIGHT = 128, 32
+FB_KEYFRAME, FB_SLAVE, FB_END = 0x01, 0x40, 0x80
+FB_STOP = 0xFF
+
+
+def write_png(path, buffer, scale):
+    # SSD1306 page layout: each byte is a column of 8 pixels, LSB on top
+    rows = []
+    for y in range(FB_HEIGHT):
+        page = (y // 8) * FB_WIDTH
+        row = bytes(255 if buffer[page + x] >> (y % 8) & 1 else 0 for x in range(FB_WIDTH) for _ in range(scale))
+        rows += [b"\0" + row] * scale
+
+    def chunk(kind, data):
+        return struct.pack(">I", len(data)) + kind + data + struct.pack(">I", zlib.crc32(kind + data))
+
+    header = struct.pack(">IIBBBBB", FB_WIDTH * scale, FB_HEIGHT * scale, 8, 0, 0, 0, 0)
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n" + chunk(b"IHDR", header) + chunk(b"IDAT", zlib.compress(b"".join(rows))) + chunk(b"IEND", b""))
+
+
+def capture(interface, args):
+    half = 1 if args.half == "slave" else 0
+    os.makedirs(args.out, exist_ok=True)
+
+    buffer = bytearray(FB_WIDTH * FB_HEIGHT // 8)
+    synced = False  # the first report of a keyframe has arrived
+    expected = None  # next report sequence number
+    saved, first_ms, times = 0, None, []
+
+    send(interface, [ord("F"), half])
+    renewed = time.monotonic()
+    try:
+        while saved < args.frames:
+            # The keyboard stops on its own unless the request is renewed
+            if time.monotonic() - renewed > 1:
+                send(interface, [ord("F"), half])
+                renewed = time.monotonic()
+
+            report = interface.read(REPORT_SIZE, timeout=200)
+            if not report or report[0] != ord("F"):
+                continue
+
+            seq, frame, flags, stamp = report[1], report[2], report[3], be16(report, 4)
+            if flags & FB_KEYFRAME and seq == 0:
+                synced, expected = True, 0
+            if not synced:
+                continue
+            if seq != expected:
+                # Lost a report, and with it part of a frame; a restart
+                # sends a fresh keyframe
+                print(f"report {expected} of frame {frame} lost, resyncing")
+                send(interface, [ord("F"), FB_STOP])
+                send(interface, [ord("F"), half])
+                synced = False
+                continue
+            expected = (seq + 1) & 0xFF
+
+            pos = 6
+            while pos + 3 <= REPORT_SIZE and report[pos + 2]:
+                offset, length = be16(report, pos), report[pos + 2]
+                buffer[offset : offset + length] = bytes(report[pos + 3 : pos + 3 + length])
+                pos += 3 + length
+
+            if flags & FB_END:
+                write_png(os.path.join(args.out, f"frame_{saved:04d}.png"), buffer, args.scale)
+                first_ms = stamp if first_ms is None else first_ms
+                times.append((stamp - first_ms) & 0xFFFF)
+                saved += 1
+    except KeyboardInterrupt:
+        pass
+    finally:
+        send(interface, [ord("F"), FB_STOP])
+
+    print(f"{saved} {args.half} frames in {args.out}")
+    if saved > 1:
+        print(f"  average {times[-1] / (saved - 1):.0f} ms per frame")
+
+    if args.video and saved:
+        if not shutil.which("ffmpeg"):
+            print("ffmpeg not found, video skipped")
+            return 1
+        rate = 1000 * (saved - 1) / times[-1] if saved > 1 and times[-1] else 10
+        pattern = os.path.join(args.out, "frame_%04d.png")
+        subprocess.run(["ffmpeg", "-y", "-loglevel", "error", "-framerate", f"{rate:.2f}", "-i", pattern, "-pix_fmt", "yuv420p", args.video])
+        print(f"  video: {args.video}")
+    return 0
+
+
+def send(interface, payload):
+    packet = [0] * (REPORT_SIZE + 1)
+    packet[1 : 1 + len(payload)] = payload
+    interface.write(bytes(packet))
+
+
+# Host actions requested by the keyboard (host_link.h). Each entry is
+# (name, available, prepare, run): prepare runs before the acknowledgement and
+# its result is handed to run after it. The daemon acknowledges only what it
+# can do, so the keyboard falls back to its keystroke macro for the rest.
+
+HOST_LINK_VERDICT = ord("V")
+HOST_LINK_GO = 0
+
+# An acknowledgement that reaches the keyboard after its timeout is ignored
+# and the fallback runs, so nothing is done until the keyboard says which
+# way it went. It answers within its 50 ms timeout; this is the margin.
+VERDICT_WAIT_S = 0.5
+
+
+def await_verdict(interface, report, backlog):
+    deadline = time.monotonic() + VERDICT_WAIT_S
+    while (remaining := deadline - time.monotonic()) > 0:
+        reply = interface.read(REPORT_SIZE, timeout=max(1, int(remaining * 1000)))
+        if not reply:
+            continue
+        if reply[0] == HOST_LINK_VERDICT and reply[1] == report[0] and reply[2] == report[1]:
+            return reply[3] == HOST_LINK_GO
+        backlog.append(reply)
+    return False
+
+
+def outcome(handled, go, args, done):
+    if not handled:
+        return "unavailable, keyboard falls back"
+    if not go:
+        return "too late, keyboard fell back"
+    return "dry run" if args.dry_run else done
+
+CLIPBOARD_COMMANDS = [
+    ["pbpaste"],
+    ["wl-paste", "--no-newline"],
+    ["xclip", "-o", "-selection", "clipboard"],
+    ["powershell", "-NoProfile", "-Command", "Get-Clipboard"],
+]
+
+# How long to wait for the keyboard's Ctrl+C to change the clipboard
+CLIPBOARD_WAIT_S = 0.5
+CLIPBOARD_POLL_S = 0.01
+
+WINDOWS_BLUETOOTH_TOGGLE = r"""
+Add-Type -AssemblyName System.Runtime.WindowsRuntime
+$asTask = ([System.WindowsRuntimeSystemExtensions].GetMethods() | ? { $_.Name -eq 'AsTask' -and $_.GetParameters().Count -eq 1 -and $_.GetParameters()[0].ParameterType.Name -eq 'IAsyncOperation`1' })[0]
+Function Await($op, $type) { $task = $asTask.MakeGenericMethod($type).Invoke($null, @($op)); $task.Wait(-1) | Out-Null; $task.Result }
+[Windows.Devices.Radios.Radio,Windows.System.Devices,ContentType=WindowsRuntime] | Out-Null
+$radios = Await ([Windows.Devices.Radios.Radio]::GetRadiosAsync()) ([System.Collections.Generic.IReadOnlyList[Windows.Devices.Radios.Radio]])
+$bt = $radios | ? { $_.Kind -eq 'Bluetooth' }
+$state = if ($bt.State -eq 'On') { 'Off' } else { 'On' }
+Await ($bt.SetStateAsync($state)) ([Windows.Devices.Radios.RadioAccessStatus]) | Out-Null
+"""
+
+
+def clipboard_command():
+    return next((cmd for cmd in CLIPBOARD_COMMANDS if shutil.which(cmd[0])), None)
+
+
+def read_clipboard():
+    return subprocess.run(clipboard_command(), capture_output=True, text=True).stdout.strip()
+
+
+def send_to_new_tab(args, before):
+    # The keyboard taps Ctrl+C once it has the acknowledgement. Wait for the
+    # copy to land; if the selection is what was already on the clipboard it
+    # never changes, so stop waiting after a while and use it as it is.
+    deadline = time.monotonic() + CLIPBOARD_WAIT_S
+    text = read_clipboard()
+    while text == before and time.monotonic() < deadline:
+        time.sleep(CLIPBOARD_POLL_S)
+        text = read_clipboard()
+    if not text:
+        return
+
+    url = text if urllib.parse.urlparse(text).scheme in ("http", "https") else args.search_url.format(urllib.parse.quote_plus(text))
+    webbrowser.open_new_tab(url)
+
+
+def bluetooth_command():
+    if sys.platform == "darwin":
+        return ["blueutil", "--power", "toggle"]
+    if sys.platform == "win32":
+        return ["powershell", "-NoProfile", "-Command", WINDOWS_BLUETOOTH_TOGGLE]
+    return ["rfkill", "toggle", "bluetooth"]
+
+
+def bluetooth_toggle(args, prepared):
+    subprocess.Popen(bluetooth_command())
+
+
+HOST_ACTIONS = {
+    1: ("send-to-new-tab", lambda: clipboard_command() is not None, read_clipboard, send_to_new_tab),
+    2: ("bluetooth-toggle", lambda: shutil.which(bluetooth_command()[0]) is not None, lambda: None, bluetooth_toggle),
+}
+
+
+def handle_action(interface, report, args, backlog):
+    seq, action = report[1], report[2]
+    name, available, prepare, run = HOST_ACTIONS.get(action, (f"unknown {action}", lambda: False, None, None))
+
+    handled = args.dry_run or available()
+    prepared = prepare() if handled and not args.dry_run else None
+    send(interface, [report[0], seq, 0 if handled else 1])
+    go = handled and await_verdict(interface, report, backlog)
+    print(f"{time.strftime('%H:%M:%S')} action {name}: {outcome(handled, go, args, 'run')}")
+
+    if go and not args.dry_run:
+        run(args, prepared)
+
+
+# Unicode batches (unicode_batch.h): a count, then big-endian 24-bit code
+# points. Typed here as text instead of one WinCompose sequence per character.
+
+
+def inject_windows(text):
+    import ctypes
+    from ctypes import wintypes
+
+    class KEYBDINPUT(ctypes.Structure):
+        _fields_ = [
+            ("wVk", wintypes.WORD),
+            ("wScan", wintypes.WORD),
+            ("dwFlags", wintypes.DWORD),
+            ("time", wintypes.DWORD),
+            ("dwExtraInfo", ctypes.c_size_t),
+        ]
+
+    class INPUT(ctypes.Structure):
+        # Padded to the size of the MOUSEINPUT member of the union
+        _fields_ = [("type", wintypes.DWORD), ("ki", KEYBDINPUT), ("padding", ctypes.c_ubyte * 8)]
+
+    INPUT_KEYBOARD, KEYEVENTF_KEYUP, KEYEVENTF_UNICODE = 1, 0x2, 0x4
+
+    # Code points above the BMP go in as surrogate pairs
+    units = text.encode("utf-16-le")
+    inputs = []
+    for i in range(0, len(units), 2):
+        unit = units[i] | (units[i + 1] << 8)
+        for flags in (KEYEVENTF_UNICODE, KEYEVENTF_UNICODE | KEYEVENTF_KEYUP):
+            inputs.append(INPUT(INPUT_KEYBOARD, KEYBDINPUT(0, unit, flags, 0, 0)))
+
+    array = (INPUT * len(inputs))(*inputs)
+    ctypes.windll.user32.SendInput(len(inputs), array, ctypes.sizeof(INPUT))
+
+
+def unicode_command():
+    if sys.platform == "win32":
+        return inject_windows
+    for tool in (["wtype", "--"], ["xdotool", "type", "--"]):
+        if shutil.which(tool[0]):
+            return lambda text, tool=tool: subprocess.run(tool + [text])
+    return None
+
+
+def handle_unicode(interface, report, args, backlog):
+    seq, count = report[1], min(report[2], (REPORT_SIZE - 3) // 3)
+    text = "".join(chr((report[3 + i * 3] << 16) | (report[4 + i * 3] << 8) | report[5 + i * 3]) for i in range(count))
+
+    inject = unicode_command()
+    handled = args.dry_run or inject is not None
+    send(interface, [report[0], seq, 0 if handled else 1])
+    go = handled and await_verdict(interface, report, backlog)
+    print(f"{time.strftime('%H:%M:%S')} unicode {text!r}: {outcome(handled, go, args, 'typed')}")
+
+    if go and not args.dry_run:
+        inject(text)
+
+
+def daemon(interface, args):
+    handlers = {ord("A"): handle_action, ord("U"): handle_unicode}
+
+    # Requests that arrived while waiting on a verdict
+    backlog = collections.deque()
+
+    print("Listening for host requests, Ctrl+C to stop")
+    try:
+        while True:
+            report = backlog.popleft() if backlog else interface.read(REPORT_SIZE, timeout=1000)
+            if report and report[0] in handlers:
+                handlers[report[0]](interface, report, args, backlog)
+    except KeyboardInterrupt:
+        return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Raw HID tools for the Lulu")
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    boot = commands.add_parser("boot-timing", help="read reset-to-usable milestones")
+    boot.add_argument("--previous", action="store_true", help="read the run before the last soft reset")
+    boot.set_defaults(func=boot_timing)
+
+    watchdog = commands.add_parser("widgets", help="read OLED widget render levels and overruns (both halves)")
+    watchdog.set_defaults(func=widgets)
+
+    game = commands.add_parser("game", help="read the game profile state and main loop rate for each profile")
+    game.set_defaults(func=game_profile)
+
+    queue = commands.add_parser("queue", help="read key events held back during macros and queue overflows")
+    queue.set_defaults(func=key_queue)
+
+    tune = commands.add_parser("settings", help="read or change the host-tunable timing settings")
+    tune.add_argument("action", nargs="?", choices=SETTINGS_OPS, default="show")
+    tune.add_argument("name", nargs="?", help="setting to change: " + ", ".join(SETTINGS))
+    tune.add_argument("value", nargs="?", type=int, help="new value in milliseconds")
+    tune.set_defaults(func=settings)
+
+    fb = commands.add_parser("capture", help="save OLED frames from either half as PNGs (needs FB_CAPTURE_ENABLE)")
+    fb.add_argument("--half", choices=["master", "slave"], default="master")
+    fb.add_argument("--frames", type=int, default=50, help="frames to save; Ctrl+C stops early")
+    fb.add_argument("--out", default="capture", help="directory for frame_NNNN.png")
+    fb.add_argument("--scale", type=int, default=4)
+    fb.add_argument("--video", help="also encode the frames to this file with ffmpeg")
+    fb.set_defaults(func=capture)
+
+    companion = commands.add_parser("daemon", help="carry out host actions and Unicode input requested by the keyboard")
+    companion.add_argument("--dry-run", action="store_true", help="acknowledge and log requests without acting on them")
+    companion.add_argument("--search-url", default="https://www.google.com/search?q={}", help="used when the clipboard is not a URL")
+    companion.set_defaults(func=daemon)
+
+    args = parser.parse_args()
+
+    interface = get_raw_hid_interface()
+    if interface is None:
+        print("Lulu not found. Ensure Raw HID is enabled and device is connected.")
+        return 1
+
+    try:
+        return args.func(interface, args)
+    finally:
+        interface.close()
+
+
+if __name__ == "__main__":
+    sys.exit(main())
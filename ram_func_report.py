@@ -0,0 +1,65 @@
+"""Confirm that HOT_PATH() functions and HOT_DATA() bitmaps were linked into SRAM.
+
+Reads the GNU ld map file from a QMK build and lists every .time_critical.*
+input section with its address, flagging any that ended up outside SRAM.
+
+    python ram_func_report.py .build/boardsource_lulu_rp2040_kbdd.map
+"""
+
+import argparse
+import re
+import sys
+
+# RP2040 striped SRAM plus the two scratch banks
+SRAM_START = 0x20000000
+SRAM_END = 0x20042000
+
+SECTION_RE = re.compile(r"^\s*\.time_critical\.(\S+)\s*(?:\n\s*)?(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)\s+(\S+)", re.MULTILINE)
+
+EXPECTED = [
+    "process_record_user",
+    "matrix_scan_user",
+    "event_post",
+    "set_slug_lock",
+    "boot_timing_mark",
+    "encoder_feedback_note",
+    "draw_wpm_slice_pixels",
+    "keycode_at_keymap_location",
+    "asset_atlas",
+    "horizon_0",
+    "horizon_1",
+    "horizon_2",
+    "horizon_3",
+]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("map_file")
+    args = parser.parse_args()
+
+    with open(args.map_file) as f:
+        sections = SECTION_RE.findall(f.read())
+
+    placed = {}
+    for name, address, size, obj in sections:
+        address, size = int(address, 16), int(size, 16)
+        if size == 0:
+            continue
+        placed[name] = address
+        where = "SRAM" if SRAM_START <= address < SRAM_END else "FLASH"
+        print(f"{where:<6} 0x{address:08x} {size:>6} {name:<28} {obj}")
+
+    failed = False
+    for name in EXPECTED:
+        if name not in placed:
+            print(f"missing: {name} (not marked HOT_PATH/HOT_DATA, inlined, or HOT_PATH_IN_FLASH set)")
+            failed = True
+        elif not SRAM_START <= placed[name] < SRAM_END:
+            failed = True
+
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
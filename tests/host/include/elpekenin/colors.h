@@ -0,0 +1,2 @@
+#pragma once
+enum { HUE_RED, HUE_GREEN, HUE_YELLOW, HUE_PURPLE, HUE_ORANGE, HUE_BLUE, HUE_MAGENTA, HUE_CYAN };
@@ -0,0 +1,5 @@
+#pragma once
+typedef struct {int x;} indicator_t;
+#define ASSIGNED_KEYCODE_IN_LAYER_INDICATOR(l,c) {0}
+#define KEYCODE_INDICATOR(k,c) {0}
+#define LAYER_INDICATOR(l,c) {0}
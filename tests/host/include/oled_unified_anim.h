@@ -0,0 +1,10 @@
+#pragma once
+typedef struct { int x; } unified_anim_config_t;
+typedef struct { uint32_t t; } unified_anim_t;
+#define UNIFIED_TOGGLE_CONFIG(s, x, y, b) {0}
+#define UNIFIED_BOOTREV_CONFIG(s, x, y, b) {0}
+#define UNIFIED_LOOP_CONFIG(s, x, y, a, b) {0}
+void unified_anim_init(unified_anim_t *, const unified_anim_config_t *, uint8_t, uint32_t);
+void unified_anim_trigger(unified_anim_t *, uint8_t, uint32_t);
+void unified_anim_render(unified_anim_t *, uint32_t);
+bool unified_anim_boot_done(unified_anim_t *);
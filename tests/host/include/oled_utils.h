@@ -0,0 +1,10 @@
+#pragma once
+typedef struct { const uint8_t *data; uint8_t w, h; } slice_t;
+#define SLICE_CUSTOM_PX(p, w, h) {(p), (w), (h)}
+#define SLICE128x32(p) SLICE_CUSTOM_PX(p, 128, 32)
+#define DEFINE_SLICE_SEQ(name, ...) static const slice_t name##_s[] = {__VA_ARGS__}; static const int name = 0
+bool slice_is_valid(const slice_t *);
+uint8_t slice_width_px(const slice_t *);
+uint8_t slice_height_px(const slice_t *);
+void draw_slice_px_or(const slice_t *, uint8_t, uint8_t);
+void clear_rect(uint8_t, uint8_t, uint8_t, uint8_t);
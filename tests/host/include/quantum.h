@@ -0,0 +1,205 @@
+#pragma once
+// Host stand-in for QMK_KEYBOARD_H: just the types, constants and prototypes
+// the kbdd keymap modules use. Tests define the functions they call.
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#define PROGMEM
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define memcpy_P memcpy
+#define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
+#define MATRIX_ROWS 10
+#define MATRIX_COLS 6
+#define NUM_ENCODERS 1
+#define NUM_DIRECTIONS 2
+#define SAFE_RANGE 0x7e40
+#define RGB_MATRIX_LED_COUNT 70
+#define OLED_DISPLAY_WIDTH 128
+#define OLED_DISPLAY_HEIGHT 32
+#define OLED_MATRIX_SIZE 512
+#define RAW_EPSIZE 32
+typedef uint32_t layer_state_t;
+extern layer_state_t layer_state;
+typedef struct { uint8_t col, row; } keypos_t;
+typedef struct { keypos_t key; uint16_t time; uint8_t type; bool pressed; } keyevent_t;
+typedef struct { uint8_t count; bool interrupted; } tap_t;
+typedef struct { keyevent_t event; tap_t tap; uint16_t keycode; } keyrecord_t;
+typedef struct { uint8_t count; } tap_dance_state_t;
+typedef struct { int x; } tap_dance_action_t;
+typedef int oled_rotation_t;
+typedef struct { uint8_t r, g, b; } rgb_t;
+typedef struct { uint8_t h, s, v; } hsv_t;
+typedef uint32_t deferred_token;
+#define INVALID_DEFERRED_TOKEN 0
+deferred_token defer_exec(uint32_t delay_ms, uint32_t (*callback)(uint32_t trigger_time, void *cb_arg), void *cb_arg);
+bool cancel_deferred_exec(deferred_token token);
+bool extend_deferred_exec(deferred_token token, uint32_t delay_ms);
+#define MAKE_KEYPOS(r, c) ((keypos_t){.row = (r), .col = (c)})
+#define KEY_EVENT 1
+#define MAKE_KEYEVENT(r, c, p) ((keyevent_t){.key = MAKE_KEYPOS(r, c), .pressed = (p), .time = timer_read(), .type = KEY_EVENT})
+void action_exec(keyevent_t event);
+uint16_t timer_read(void);
+uint32_t timer_read32(void);
+uint16_t timer_elapsed(uint16_t);
+uint32_t timer_elapsed32(uint32_t);
+#define TIMER_DIFF_16(a, b) ((uint16_t)((a) - (b)))
+#define TIMER_DIFF_32(a, b) ((uint32_t)((a) - (b)))
+void wait_ms(uint32_t);
+bool is_keyboard_master(void);
+bool is_keyboard_left(void);
+bool is_transport_connected(void);
+uint8_t get_mods(void);
+uint8_t get_oneshot_mods(void);
+void add_weak_mods(uint8_t);
+void del_weak_mods(uint8_t);
+void clear_weak_mods(void);
+void add_key(uint8_t);
+void del_key(uint8_t);
+void send_keyboard_report(void);
+void clear_oneshot_mods(void);
+uint8_t get_highest_layer(layer_state_t);
+void tap_code(uint8_t);
+void tap_code16(uint16_t);
+void register_code16(uint16_t);
+void unregister_code16(uint16_t);
+void register_unicode(uint32_t);
+bool is_caps_word_on(void);
+uint32_t last_input_activity_elapsed(void);
+void oled_on(void);
+void oled_off(void);
+bool is_oled_on(void);
+void oled_render_dirty(bool);
+uint32_t port_rt_get_counter_value(void);
+void oled_clear(void);
+bool oled_write_pixel(uint8_t, uint8_t, bool);
+typedef struct { uint8_t *current_element; uint16_t remaining_element_count; } oled_buffer_reader_t;
+oled_buffer_reader_t oled_read_raw(uint16_t);
+void rgb_matrix_set_color(int, uint8_t, uint8_t, uint8_t);
+uint8_t rgb_matrix_get_mode(void);
+void rgb_matrix_mode_noeeprom(uint8_t);
+uint8_t rgb_matrix_get_val(void);
+uint8_t rgb_matrix_get_hue(void);
+uint8_t rgb_matrix_get_sat(void);
+void rgb_matrix_sethsv_noeeprom(uint8_t, uint8_t, uint8_t);
+void rgb_matrix_set_color_all(uint8_t, uint8_t, uint8_t);
+void rgb_matrix_update_pwm_buffers(void);
+#define RGB_MATRIX_SOLID_COLOR 1
+#define RGB_MATRIX_TYPING_HEATMAP 2
+layer_state_t update_tri_layer_state(layer_state_t, uint8_t, uint8_t, uint8_t);
+#define SEND_STRING(s) send_string(s)
+void send_string(const char *);
+void raw_hid_send(uint8_t *, uint8_t);
+struct usb_device_state { int configure_state; };
+#define USB_DEVICE_STATE_CONFIGURED 2
+uint16_t keycode_at_keymap_location_raw(uint8_t, uint8_t, uint8_t);
+uint16_t keymap_key_to_keycode(uint8_t, keypos_t);
+extern const uint8_t ascii_to_keycode_lut[128];
+extern const uint8_t ascii_to_shift_lut[16];
+extern const uint8_t ascii_to_altgr_lut[16];
+extern const uint8_t ascii_to_dead_lut[16];
+#define LAYOUT(...) {{0}}
+#define ENCODER_CCW_CW(a, b) {(a), (b)}
+#define MOD_MASK_GUI 0x88
+#define MOD_MASK_ALT 0x44
+#define MOD_MASK_SHIFT 0x22
+#define MOD_MASK_CTRL 0x11
+#define MOD_BIT(kc) (1 << ((kc) & 7))
+#define MOD_LSFT 0x02
+#define MOD_LGUI 0x08
+#define MOD_LALT 0x04
+#define MOD_LCTL 0x01
+#define MOD_RSFT 0x12
+#define MOD_RGUI 0x18
+#define MOD_RALT 0x14
+#define MOD_RCTL 0x11
+#define MT(m, k) (0x2000 | ((m) << 8) | (k))
+#define MO(l) (0x5220 | (l))
+#define TO(l) (0x5200 | (l))
+#define TT(l) (0x52C0 | (l))
+#define TG(l) (0x5260 | (l))
+#define TD(n) (0x5700 | (n))
+#define UM(n) (0x8000 | (n))
+#define UP(a, b) (0xC000 | (a) | ((b) << 7))
+#define QK_UNICODEMAP 0x8000
+#define QK_UNICODEMAP_MAX 0xBFFF
+#define QK_UNICODEMAP_PAIR 0xC000
+#define QK_UNICODEMAP_PAIR_MAX 0xFFFF
+uint16_t unicodemap_index(uint16_t);
+uint32_t unicodemap_get_code_point(uint16_t);
+#define QK_BASIC_MAX 0xFF
+#define QK_MODS 0x0100
+#define QK_MODS_MAX 0x1FFF
+#define C(k) (0x0100 | (k))
+#define S(k) (0x0200 | (k))
+#define A(k) (0x0400 | (k))
+#define G(k) (0x0800 | (k))
+#define LCS(k) (0x0300 | (k))
+#define LSG(k) (0x0A00 | (k))
+#define QK_BOOT 0x7C00
+#define CW_TOGG 0x7C73
+#define _______ 1
+#define XXXXXXX 0
+#define OS_LSFT 0x52A2
+enum { KC_NO, KC_TRNS, KC_A = 4, KC_B, KC_C, KC_D, KC_E, KC_F, KC_G, KC_H, KC_I, KC_J, KC_K, KC_L, KC_M, KC_N, KC_O, KC_P, KC_Q, KC_R, KC_S, KC_T, KC_U, KC_V, KC_W, KC_X, KC_Y, KC_Z,
+       KC_1, KC_2, KC_3, KC_4, KC_5, KC_6, KC_7, KC_8, KC_9, KC_0, KC_ENT, KC_ESC, KC_BSPC, KC_TAB, KC_SPC, KC_MINS, KC_EQL, KC_LBRC, KC_RBRC, KC_BSLS, KC_NUHS, KC_SCLN, KC_QUOT, KC_GRV, KC_COMM, KC_DOT, KC_SLSH,
+       KC_CAPS, KC_F1, KC_F2, KC_F3, KC_F4, KC_F5, KC_F6, KC_F7, KC_F8, KC_F9, KC_F10, KC_F11, KC_F12, KC_RIGHT = 0x4F, KC_LEFT, KC_DOWN, KC_UP, KC_HOME = 0x4A, KC_PGUP, KC_DEL, KC_END, KC_PGDN,
+       KC_PSLS = 0x54, KC_PAST, KC_PMNS, KC_PPLS, KC_P0 = 0x62, KC_PDOT, KC_MYCM = 0xC0, KC_CALC, KC_MUTE = 0xA8, KC_VOLU, KC_VOLD, KC_LCTL = 0xE0, KC_LSFT, KC_LALT, KC_LGUI, KC_RCTL, KC_RSFT, KC_RALT, KC_RGUI };
+#define KC_RGHT KC_RIGHT
+#define KC_COLN S(KC_SCLN)
+#define KC_LPRN S(KC_9)
+#define KC_RPRN S(KC_0)
+#define KC_LCBR S(KC_LBRC)
+#define KC_RCBR S(KC_RBRC)
+#define KC_UNDS S(KC_MINS)
+#define ACTION_TAP_DANCE_DOUBLE(a, b) {0}
+#define ACTION_TAP_DANCE_FN(f) {0}
+enum { ENCODER_LEDMAP_SYNC, CLOCK_SYNC, FB_CAPTURE_SYNC, SETTINGS_SYNC, WIDGET_WATCHDOG_SYNC };
+typedef void (*slave_transaction_handler_t)(uint8_t, const void *, uint8_t, void *);
+void transaction_register_rpc(int8_t, slave_transaction_handler_t);
+bool transaction_rpc_send(int8_t, uint8_t, const void *);
+bool transaction_rpc_exec(int8_t, uint8_t, const void *, uint8_t, void *);
+void eeconfig_read_user_datablock(void *, uint32_t, uint32_t);
+void eeconfig_update_user_datablock(const void *, uint32_t, uint32_t);
+typedef struct { uint8_t h, s, v; } color_t;
+#define HUE(h) ((color_t){(h), 255, 255})
+#define WHITE_COLOR ((color_t){0, 0, 255})
+#define TRNS_COLOR ((color_t){0, 0, 0})
+void get_rgb(color_t, rgb_t *);
+bool layer_state_is(uint8_t);
+#define KEYLOC_ENCODER_CW 253
+#define KEYLOC_ENCODER_CCW 252
+#define IS_ENCODEREVENT(ev) ((ev).type == 3)
+#define MAX_QUEUED_ENCODER_EVENTS 4
+typedef struct { uint8_t index : 7; uint8_t clockwise : 1; } encoder_event_t;
+typedef struct { uint8_t head; uint8_t tail; encoder_event_t queue[MAX_QUEUED_ENCODER_EVENTS]; } encoder_events_t;
+void encoder_retrieve_events(encoder_events_t *events);
+extern const uint8_t k_rgb_matrix_split[2];
+#define IS_EVENT(ev) ((ev).type != 0)
+uint8_t keymap_layer_count(void);
+#define KEYBOARD_REPORT_KEYS 6
+#define PSTR(s) (s)
+uint8_t get_weak_mods(void);
+#define pgm_read_ptr(p) (*(void * const *)(p))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define IS_QK_UNICODEMAP(code) ((code) >= QK_UNICODEMAP && (code) <= QK_UNICODEMAP_MAX)
+#define IS_QK_UNICODEMAP_PAIR(code) ((code) >= QK_UNICODEMAP_PAIR && (code) <= QK_UNICODEMAP_PAIR_MAX)
+#define IS_QK_MOD_TAP(code) ((code) >= 0x2000 && (code) <= 0x3FFF)
+#define IS_QK_LAYER_TAP(code) ((code) >= 0x4000 && (code) <= 0x4FFF)
+#define QK_MOD_TAP_GET_MODS(kc) (((kc) >> 8) & 0x1F)
+#define QK_MOD_TAP_GET_TAP_KEYCODE(kc) ((kc) & 0xFF)
+#define IS_MODIFIER_KEYCODE(code) ((code) >= 0xE0 && (code) <= 0xE7)
+#define IS_QK_LAYER_MOD(code) ((code) >= 0x5000 && (code) <= 0x51FF)
+#define IS_QK_TO(code) ((code) >= 0x5200 && (code) <= 0x521F)
+#define IS_QK_MOMENTARY(code) ((code) >= 0x5220 && (code) <= 0x523F)
+#define IS_QK_DEF_LAYER(code) ((code) >= 0x5240 && (code) <= 0x525F)
+#define IS_QK_TOGGLE_LAYER(code) ((code) >= 0x5260 && (code) <= 0x527F)
+#define IS_QK_ONE_SHOT_LAYER(code) ((code) >= 0x5280 && (code) <= 0x529F)
+#define IS_QK_ONE_SHOT_MOD(code) ((code) >= 0x52A0 && (code) <= 0x52BF)
+#define IS_QK_LAYER_TAP_TOGGLE(code) ((code) >= 0x52C0 && (code) <= 0x52DF)
+#define QK_TRI_LAYER_LOWER 0x7C77
+#define QK_TRI_LAYER_UPPER 0x7C78
+#define QK_LAYER_TAP_GET_TAP_KEYCODE(kc) ((kc) & 0xFF)
+#define RGB_RED 0xFF, 0x00, 0x00
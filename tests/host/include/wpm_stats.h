@@ -0,0 +1,2 @@
+#pragma once
+uint16_t wpm_stats_get_current(void); uint16_t wpm_stats_get_average(void);
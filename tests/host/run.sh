@@ -0,0 +1,25 @@
+#!/bin/sh
+# Build and run the host tests for the kbdd keymap modules. Each test_*.c
+# includes the module sources it exercises and builds against include/, which
+# stands in for QMK.
+set -e
+
+here=$(cd "$(dirname "$0")" && pwd)
+keymap="$here/../../keyboards/boardsource/lulu/keymaps/kbdd"
+out=$(mktemp -d)
+trap 'rm -rf "$out"' EXIT
+
+status=0
+for test in "$here"/test_*.c; do
+    name=$(basename "$test" .c)
+    ${CC:-cc} -std=gnu11 -O2 -Wall -Wextra -Wno-unused-parameter -Wno-unused-function -pthread \
+        -I"$here/include" -I"$keymap" -DQMK_KEYBOARD_H='"quantum.h"' \
+        "$test" -o "$out/$name"
+    if "$out/$name"; then
+        echo "PASS $name"
+    else
+        echo "FAIL $name"
+        status=1
+    fi
+done
+exit $status
@@ -0,0 +1,120 @@
+/**
+ * @file test_event_bus.c
+ * @brief Multithreaded stress test for the event_bus broadcast ring
+ *
+ * One producer thread posts numbered events while two readers drain at
+ * different rates. Every event a reader returns must be whole and in order,
+ * and what it read plus what it was told it dropped must add up to what was
+ * posted.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+
+#include "event_bus.c"
+
+#define POSTS 500000u
+
+static uint16_t post_time; // producer thread only
+
+uint16_t timer_read(void) { return post_time; }
+
+static volatile bool producer_done;
+
+static void *producer(void *arg) {
+    for (uint32_t n = 1; n <= POSTS; n++) {
+        post_time = (uint16_t)~n;
+        event_post(n & 3, (uint8_t)(n * 7), (uint16_t)n);
+        if ((n & 63) == 0) {
+            sched_yield();
+        }
+    }
+    __atomic_store_n(&producer_done, true, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+typedef struct {
+    event_reader_t reader;
+    unsigned       stall; // yield this often to fall behind
+    uint32_t       read, dropped, torn, backwards;
+} reader_t;
+
+static void *consumer(void *arg) {
+    reader_t *r    = arg;
+    uint16_t  last = 0;
+    event_t   event;
+    for (;;) {
+        bool done = __atomic_load_n(&producer_done, __ATOMIC_ACQUIRE);
+        while (event_read(&r->reader, &event)) {
+            uint16_t n    = event.keycode;
+            uint16_t time = ~n;
+            if (event.type != (n & 3) || event.value != (uint8_t)(n * 7) || event.time != time) {
+                r->torn++;
+            }
+            if ((uint16_t)(n - last) == 0 || (uint16_t)(n - last) > 0x8000) {
+                r->backwards++;
+            }
+            last = n;
+            r->read++;
+            // Collect before the counter can saturate.
+            r->dropped += r->reader.dropped;
+            r->reader.dropped = 0;
+            if (r->stall && r->read % r->stall == 0) {
+                sched_yield();
+            }
+        }
+        r->dropped += r->reader.dropped;
+        r->reader.dropped = 0;
+        if (done) {
+            return NULL;
+        }
+        sched_yield();
+    }
+}
+
+int main(void) {
+    reader_t fast = {.stall = 0}, slow = {.stall = 3};
+    event_reader_init(&fast.reader);
+    event_reader_init(&slow.reader);
+
+    pthread_t p, c1, c2;
+    pthread_create(&c1, NULL, consumer, &fast);
+    pthread_create(&c2, NULL, consumer, &slow);
+    pthread_create(&p, NULL, producer, NULL);
+    pthread_join(p, NULL);
+    pthread_join(c1, NULL);
+    pthread_join(c2, NULL);
+
+    int failed = 0;
+    reader_t *readers[] = {&fast, &slow};
+    for (int i = 0; i < 2; i++) {
+        reader_t *r = readers[i];
+        printf("event_bus: reader %d read %u, dropped %u, torn %u, out of order %u\n", i, r->read, r->dropped, r->torn, r->backwards);
+        failed |= r->torn || r->backwards || r->read + r->dropped != POSTS;
+    }
+
+    // A reader lapped by a whole number of byte-sized laps, or by more than
+    // a 16-bit counter holds, still sees that it fell behind: it gets the
+    // newest EVENT_BUS_SIZE - 1 events and a count of the rest.
+    static const uint32_t laps[] = {256, 70000};
+    for (int i = 0; i < 2; i++) {
+        event_reader_t idle;
+        event_reader_init(&idle);
+        for (uint32_t n = 0; n < laps[i]; n++) {
+            event_post(EVENT_KEY, 0, 0);
+        }
+
+        event_t  event;
+        uint32_t read = 0;
+        while (event_read(&idle, &event)) {
+            read++;
+        }
+        uint32_t dropped = laps[i] - (EVENT_BUS_SIZE - 1);
+        if (read != EVENT_BUS_SIZE - 1 || idle.dropped != (dropped > UINT8_MAX ? UINT8_MAX : dropped)) {
+            printf("event_bus: lapped by %u, read %u, dropped %u\n", laps[i], read, idle.dropped);
+            failed = 1;
+        }
+    }
+    return failed;
+}
@@ -0,0 +1,125 @@
+/**
+ * @file test_indicator_fade.c
+ * @brief Accuracy check for the fixed-point brightness fade
+ *
+ * The Q8 fade is compared with a double-precision smoothstep between the
+ * same levels, and the matrix value is checked through the master and slave
+ * paths.
+ */
+
+#include <stdio.h>
+
+#include "indicator_fade.c"
+#include "gamma_lut.c"
+
+settings_t settings = {
+    .lumino_soon_ms       = 15000,
+    .lumino_long_ms       = 60000,
+    .lumino_transition_ms = 500,
+};
+
+static uint32_t now, last_input;
+static bool     master = true;
+static uint8_t  matrix_val;
+
+uint32_t timer_read32(void) { return now; }
+uint32_t timer_elapsed32(uint32_t last) { return now - last; }
+uint32_t last_input_activity_elapsed(void) { return now - last_input; }
+bool     is_keyboard_master(void) { return master; }
+uint8_t  rgb_matrix_get_hue(void) { return 0; }
+uint8_t  rgb_matrix_get_sat(void) { return 0; }
+uint8_t  rgb_matrix_get_val(void) { return matrix_val; }
+void     rgb_matrix_sethsv_noeeprom(uint8_t h, uint8_t s, uint8_t v) { matrix_val = v; }
+
+static double smoothstep(double t) {
+    return t * t * (3 - 2 * t);
+}
+
+// Runs one fade from the current level, started by moving the clock to
+// `start`, and returns the largest distance from the double reference
+static int fade_error(uint32_t start, double from, double to) {
+    int worst = 0;
+    for (uint32_t t = 0; t <= settings.lumino_transition_ms + 10u; t++) {
+        now = start + t;
+        indicator_fade_task();
+
+        double x   = t >= settings.lumino_transition_ms ? 1 : (double)t / settings.lumino_transition_ms;
+        double ref = (from + (to - from) * smoothstep(x)) * 255;
+        int    err = fade_level - (int)(ref + 0.5);
+        if (err < 0) {
+            err = -err;
+        }
+        if (err > worst) {
+            worst = err;
+        }
+    }
+    return worst;
+}
+
+int main(void) {
+    int failures = 0;
+
+    // Settle at high, then idle into low and off
+    now = last_input = 1000;
+    indicator_fade_task();
+    if (fade_level != FADE_HIGH || matrix_val != fade_to_val(FADE_HIGH)) {
+        printf("start: level %u, val %u\n", fade_level, matrix_val);
+        failures++;
+    }
+
+    int high_low = fade_error(last_input + settings.lumino_soon_ms, LUMINO_HIGH_BRIGHTNESS, LUMINO_LOW_BRIGHTNESS);
+    int low_off  = fade_error(last_input + settings.lumino_long_ms, LUMINO_LOW_BRIGHTNESS, 0);
+    printf("indicator_fade: worst error %d/255 high to low, %d/255 low to off\n", high_low, low_off);
+    if (high_low > 2 || low_off > 2 || fade_level != 0 || matrix_val != 0) {
+        failures++;
+    }
+
+    // Activity brings it straight back up, and the end level is exact
+    last_input = now;
+    fade_error(now + 1, 0, LUMINO_HIGH_BRIGHTNESS);
+    if (fade_level != FADE_HIGH || fade_shown != FADE_HIGH) {
+        printf("wake: level %u, shown %u\n", fade_level, fade_shown);
+        failures++;
+    }
+
+    // A transition setting changed mid-fade applies from the next fade; this
+    // one still ends on time and stays between its levels
+    uint8_t from = fade_level;
+    now += settings.lumino_soon_ms;
+    indicator_fade_task();
+    settings.lumino_transition_ms = 5000;
+    uint8_t lowest = from, highest = 0;
+    for (uint32_t t = 0; t <= 500; t++, now++) {
+        indicator_fade_task();
+        lowest  = MIN(lowest, fade_level);
+        highest = MAX(highest, fade_level);
+    }
+    settings.lumino_transition_ms = 500;
+    if (fade_level != FADE_LOW || lowest < FADE_LOW || highest > from) {
+        printf("retimed: level %u, range %u-%u\n", fade_level, lowest, highest);
+        failures++;
+    }
+
+    // The slave takes the level from the synced value
+    master     = false;
+    matrix_val = fade_to_val(FADE_LOW);
+    indicator_fade_task();
+    if (fade_shown != FADE_LOW) {
+        printf("slave: shown %u for val %u\n", fade_shown, matrix_val);
+        failures++;
+    }
+    master = true;
+
+    // LUMINO key cycles high, low, off
+    uint8_t cycle[3];
+    for (uint8_t i = 0; i < 3; i++) {
+        indicator_fade_cycle();
+        cycle[i] = fade_awake;
+    }
+    if (cycle[0] != FADE_LOW || cycle[1] != 0 || cycle[2] != FADE_HIGH) {
+        printf("cycle: %u %u %u\n", cycle[0], cycle[1], cycle[2]);
+        failures++;
+    }
+
+    return failures != 0;
+}
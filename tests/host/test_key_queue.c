@@ -0,0 +1,135 @@
+/**
+ * @file test_key_queue.c
+ * @brief Injection test for the key_queue macro buffer
+ *
+ * A stand-in action_exec() runs each event through key_queue_process() the
+ * way pre_process_record_user() does and logs what gets through. Whatever is
+ * injected while a macro holds the queue, including more events than the
+ * queue holds, must come out once, in the order it was typed.
+ */
+
+#include <stdio.h>
+
+#define RAW_ENABLE
+#include "key_queue.c"
+
+#define MACRO_COL 0xFF // an event in this column starts a macro
+
+static uint16_t log_time[64];
+static uint8_t  log_count;
+static uint8_t  raw_report[32];
+
+uint16_t timer_read(void) { return 0; }
+
+void raw_hid_send(uint8_t *data, uint8_t length) { memcpy(raw_report, data, length); }
+
+void action_exec(keyevent_t event) {
+    keyrecord_t record = {.event = event};
+    if (!key_queue_process(&record)) {
+        return;
+    }
+    if (event.key.col == MACRO_COL) {
+        key_queue_hold();
+    }
+    log_time[log_count++] = event.time;
+}
+
+static void inject(uint16_t time, uint8_t col) {
+    action_exec((keyevent_t){.key = MAKE_KEYPOS(0, col), .time = time, .type = KEY_EVENT, .pressed = true});
+}
+
+static void reset(void) {
+    head = count = holders = high_water = log_count = 0;
+    queued = overflows = 0;
+}
+
+// The log must be exactly 1..n
+static int check_order(const char *name, uint8_t n) {
+    int failures = 0;
+    if (log_count != n) {
+        printf("%s: %u events out, expected %u\n", name, log_count, n);
+        failures++;
+    }
+    for (uint8_t i = 0; i < log_count; i++) {
+        if (log_time[i] != i + 1) {
+            printf("%s: position %u is event %u\n", name, i, log_time[i]);
+            failures++;
+        }
+    }
+    return failures;
+}
+
+int main(void) {
+    int failures = 0;
+
+    // Held, then replayed in order on release
+    reset();
+    key_queue_hold();
+    for (uint16_t t = 1; t <= 5; t++) {
+        inject(t, 1);
+    }
+    failures += log_count != 0;
+    key_queue_release();
+    failures += check_order("held", 5);
+
+    // Overflow: the event that finds the queue full goes behind the ones
+    // already queued, never ahead of them
+    reset();
+    key_queue_hold();
+    for (uint16_t t = 1; t <= KEY_QUEUE_SIZE + 4; t++) {
+        inject(t, 1);
+    }
+    if (log_count != KEY_QUEUE_SIZE || count != 4 || overflows != 1) {
+        printf("overflow: %u out, %u queued, %u overflows\n", log_count, count, overflows);
+        failures++;
+    }
+    key_queue_release();
+    failures += check_order("overflow", KEY_QUEUE_SIZE + 4);
+
+    // A replayed event that starts another macro keeps the rest queued until
+    // that one releases
+    reset();
+    key_queue_hold();
+    inject(1, 1);
+    inject(2, MACRO_COL);
+    inject(3, 1);
+    key_queue_release();
+    if (log_count != 2 || count != 1 || !key_queue_holding()) {
+        printf("nested: %u out, %u queued\n", log_count, count);
+        failures++;
+    }
+    key_queue_release();
+    failures += check_order("nested", 3);
+
+    // Overflow while flushing into a macro started by a flushed event
+    reset();
+    key_queue_hold();
+    inject(1, MACRO_COL);
+    for (uint16_t t = 2; t <= KEY_QUEUE_SIZE + 2; t++) {
+        inject(t, 1);
+    }
+    key_queue_release();
+    key_queue_release();
+    failures += check_order("nested overflow", KEY_QUEUE_SIZE + 2);
+
+    // Not holding: straight through
+    reset();
+    inject(1, 1);
+    failures += check_order("idle", 1);
+
+    uint8_t report[32] = {KEY_QUEUE_HID_COMMAND};
+    reset();
+    key_queue_hold();
+    for (uint16_t t = 1; t <= KEY_QUEUE_SIZE + 1; t++) {
+        inject(t, 1);
+    }
+    key_queue_release();
+    key_queue_raw_hid(report, sizeof(report));
+    if (raw_report[1] != KEY_QUEUE_SIZE || raw_report[2] != KEY_QUEUE_SIZE || raw_report[4] != KEY_QUEUE_SIZE + 1 || raw_report[6] != 1) {
+        printf("report: capacity %u, high water %u, queued %u, overflows %u\n", raw_report[1], raw_report[2], raw_report[4], raw_report[6]);
+        failures++;
+    }
+
+    printf("key_queue: %d failures\n", failures);
+    return failures != 0;
+}
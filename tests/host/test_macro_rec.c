@@ -0,0 +1,201 @@
+/**
+ * @file test_macro_rec.c
+ * @brief Capacity and round-trip test for the delta-encoded macro recorder
+ *
+ * Typing is simulated at several speeds from a fixed text: presses at the
+ * WPM's character interval with jitter, holds long enough to roll over at
+ * speed, capitals as shifted keycodes and pauses between sentences. Each run
+ * records until the arena is full, reports events per KB, and plays the
+ * macro back on a stand-in deferred executor. Timed playback must give back
+ * every event in order, each within one tick of when it was typed; fast
+ * playback only the order. Keys still down when the arena filled are
+ * released at the end.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "key_queue.c"
+#include "macro_rec.c"
+
+void action_exec(keyevent_t event) {}
+
+// One deferred slot is all the player needs
+static uint32_t (*slot)(uint32_t, void *);
+static uint32_t slot_trigger;
+static uint32_t now;
+
+deferred_token defer_exec(uint32_t delay_ms, uint32_t (*callback)(uint32_t, void *), void *cb_arg) {
+    if (slot) {
+        return INVALID_DEFERRED_TOKEN;
+    }
+    slot         = callback;
+    slot_trigger = now + delay_ms;
+    return 1;
+}
+
+// Events as typed and as played back
+typedef struct {
+    uint16_t keycode;
+    bool     pressed;
+    uint32_t time;
+} logged_t;
+
+#define LOG_MAX 4096
+
+static logged_t typed[LOG_MAX], played[LOG_MAX];
+static uint16_t typed_count, played_count;
+
+static void play_log(uint16_t keycode, bool pressed) {
+    played[played_count++] = (logged_t){keycode, pressed, now};
+}
+
+void register_code16(uint16_t keycode) { play_log(keycode, true); }
+void unregister_code16(uint16_t keycode) { play_log(keycode, false); }
+
+static const char text[] = "The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs. "
+                           "How vexingly quick daft zebras jump! Sphinx of black quartz, judge my vow. ";
+
+static uint16_t char_keycode(char c) {
+    if (c >= 'a' && c <= 'z') {
+        return KC_A + (c - 'a');
+    }
+    if (c >= 'A' && c <= 'Z') {
+        return S(KC_A + (c - 'A'));
+    }
+    switch (c) {
+        case '.':
+            return KC_DOT;
+        case ',':
+            return KC_COMM;
+        case '!':
+            return S(KC_1);
+        default:
+            return KC_SPC;
+    }
+}
+
+static int cmp_time(const void *a, const void *b) {
+    const logged_t *x = a, *y = b;
+    return x->time != y->time ? (x->time > y->time) - (x->time < y->time) : x->pressed - y->pressed;
+}
+
+// Typed events for one speed, sorted by time; releases before presses on a tie
+static void simulate(uint16_t wpm) {
+    uint32_t interval = 60000 / (wpm * 5);
+    uint32_t t        = 1000;
+
+    srand(wpm);
+    typed_count = 0;
+    for (uint16_t i = 0; typed_count + 2 <= LOG_MAX; i++) {
+        char     c    = text[i % (sizeof(text) - 1)];
+        uint32_t hold = 60 + rand() % 60;
+
+        // Same key again: wait for its release first
+        if (typed_count >= 2 && typed[typed_count - 2].keycode == char_keycode(c) && t < typed[typed_count - 1].time + 10) {
+            t = typed[typed_count - 1].time + 10;
+        }
+        typed[typed_count++] = (logged_t){char_keycode(c), true, t};
+        typed[typed_count++] = (logged_t){char_keycode(c), false, t + hold};
+
+        t += interval * (60 + rand() % 80) / 100;
+        if (c == '.' || c == '!') {
+            t += 1500 + rand() % 2000;
+        }
+    }
+    qsort(typed, typed_count, sizeof(typed[0]), cmp_time);
+}
+
+// Feeds typed events to the recorder until it stops; returns how many fit
+static uint16_t record(void) {
+    macro_rec_toggle();
+    uint16_t n = 0;
+    for (; n < typed_count && macro_rec_recording(); n++) {
+        keyrecord_t record = {.event = {.time = (uint16_t)typed[n].time, .type = KEY_EVENT, .pressed = typed[n].pressed}};
+        macro_rec_process(typed[n].keycode, &record);
+    }
+    if (macro_rec_recording()) {
+        macro_rec_toggle();
+    } else {
+        n--; // the one that did not fit
+    }
+    return n;
+}
+
+static void play(bool timed_playback) {
+    played_count = 0;
+    now          = 0;
+    macro_rec_play(timed_playback);
+    while (slot) {
+        if (now == slot_trigger) {
+            uint32_t delay = slot(now, NULL);
+            slot_trigger   = now + delay;
+            if (!delay) {
+                slot = NULL;
+            }
+        }
+        now++;
+    }
+}
+
+static bool down_at_end(uint16_t keycode, uint16_t count) {
+    bool down = false;
+    for (uint16_t i = 0; i < count; i++) {
+        if (typed[i].keycode == keycode) {
+            down = typed[i].pressed;
+        }
+    }
+    return down;
+}
+
+static int check(const char *name, uint16_t count, bool timed_playback) {
+    if (played_count < count) {
+        printf("%s: played %u of %u events\n", name, played_count, count);
+        return 1;
+    }
+    // Past the recording, only releases of keys it left down
+    for (uint16_t i = count; i < played_count; i++) {
+        if (played[i].pressed || !down_at_end(played[i].keycode, count)) {
+            printf("%s: extra event %04X/%d\n", name, played[i].keycode, played[i].pressed);
+            return 1;
+        }
+    }
+    for (uint16_t i = 0; i < count; i++) {
+        if (played[i].keycode != typed[i].keycode || played[i].pressed != typed[i].pressed) {
+            printf("%s: event %u is %04X/%d, typed %04X/%d\n", name, i, played[i].keycode, played[i].pressed, typed[i].keycode, typed[i].pressed);
+            return 1;
+        }
+        if (timed_playback) {
+            int32_t error = (int32_t)(played[i].time - played[0].time) - (int32_t)(typed[i].time - typed[0].time);
+            if (error <= -MACRO_REC_TICK_MS || error >= MACRO_REC_TICK_MS) {
+                printf("%s: event %u off by %d ms\n", name, i, error);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+int main(void) {
+    static const uint16_t speeds[] = {40, 80, 120};
+    int                   failures = 0;
+
+    printf("macro_rec: %u-byte arena, %u ms ticks\n", MACRO_REC_ARENA_SIZE, MACRO_REC_TICK_MS);
+    for (uint8_t i = 0; i < ARRAY_SIZE(speeds); i++) {
+        simulate(speeds[i]);
+        uint16_t count = record();
+
+        printf("macro_rec: %3u WPM, %u events in %u bytes, %u events per KB\n", speeds[i], count, length, count * 1024u / length);
+
+        char name[16];
+        snprintf(name, sizeof(name), "%u WPM", speeds[i]);
+        play(true);
+        failures += check(name, count, true);
+        play(false);
+        failures += check(name, count, false);
+        failures += key_queue_holding();
+    }
+
+    printf("macro_rec: %d failures\n", failures);
+    return failures != 0;
+}
@@ -0,0 +1,266 @@
+/**
+ * @file test_packed_string.c
+ * @brief Output check and characters-per-second table for the packed sender
+ *
+ * Keyboard reports are decoded the way a host would: a key that is down in
+ * a report and was not in the one before types a character, shifted if the
+ * report has shift. Every string must come out exactly, with no report that
+ * changes modifiers and presses a key at once.
+ *
+ * The table assumes one report per millisecond, a 1 kHz USB poll, for both
+ * senders. SEND_STRING() is counted at two reports a character, four when it
+ * needs shift; the packed figure is measured on the deferred executor.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "key_queue.c"
+#include "packed_string.c"
+#include "macro_seq.c"
+
+// US ANSI, as the real tables are for the default layout
+const uint8_t ascii_to_keycode_lut[128] = {
+    ['\b'] = 0x2A, ['\t'] = 0x2B, ['\n'] = 0x28, [' '] = 0x2C,
+    ['!'] = 0x1E, ['"'] = 0x34, ['#'] = 0x20, ['$'] = 0x21, ['%'] = 0x22, ['&'] = 0x24, ['\''] = 0x34, ['('] = 0x26, [')'] = 0x27, ['*'] = 0x25, ['+'] = 0x2E, [','] = 0x36, ['-'] = 0x2D, ['.'] = 0x37, ['/'] = 0x38,
+    ['0'] = 0x27, ['1'] = 0x1E, ['2'] = 0x1F, ['3'] = 0x20, ['4'] = 0x21, ['5'] = 0x22, ['6'] = 0x23, ['7'] = 0x24, ['8'] = 0x25, ['9'] = 0x26,
+    [':'] = 0x33, [';'] = 0x33, ['<'] = 0x36, ['='] = 0x2E, ['>'] = 0x37, ['?'] = 0x38, ['@'] = 0x1F,
+    ['A'] = 0x04, ['B'] = 0x05, ['C'] = 0x06, ['D'] = 0x07, ['E'] = 0x08, ['F'] = 0x09, ['G'] = 0x0A, ['H'] = 0x0B, ['I'] = 0x0C, ['J'] = 0x0D, ['K'] = 0x0E, ['L'] = 0x0F, ['M'] = 0x10,
+    ['N'] = 0x11, ['O'] = 0x12, ['P'] = 0x13, ['Q'] = 0x14, ['R'] = 0x15, ['S'] = 0x16, ['T'] = 0x17, ['U'] = 0x18, ['V'] = 0x19, ['W'] = 0x1A, ['X'] = 0x1B, ['Y'] = 0x1C, ['Z'] = 0x1D,
+    ['['] = 0x2F, ['\\'] = 0x31, [']'] = 0x30, ['^'] = 0x23, ['_'] = 0x2D, ['`'] = 0x35,
+    ['a'] = 0x04, ['b'] = 0x05, ['c'] = 0x06, ['d'] = 0x07, ['e'] = 0x08, ['f'] = 0x09, ['g'] = 0x0A, ['h'] = 0x0B, ['i'] = 0x0C, ['j'] = 0x0D, ['k'] = 0x0E, ['l'] = 0x0F, ['m'] = 0x10,
+    ['n'] = 0x11, ['o'] = 0x12, ['p'] = 0x13, ['q'] = 0x14, ['r'] = 0x15, ['s'] = 0x16, ['t'] = 0x17, ['u'] = 0x18, ['v'] = 0x19, ['w'] = 0x1A, ['x'] = 0x1B, ['y'] = 0x1C, ['z'] = 0x1D,
+    ['{'] = 0x2F, ['|'] = 0x31, ['}'] = 0x30, ['~'] = 0x35,
+};
+
+// Bit per character: !"#$%&()*+:<>?@A-Z^_{|}~
+const uint8_t ascii_to_shift_lut[16] = {
+    0x00, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xC7, 0x00, 0x00, 0x00, 0x78,
+};
+
+void action_exec(keyevent_t event) {}
+
+// Deferred executor with a settable number of slots
+#define SLOTS_MAX 4
+
+typedef struct {
+    uint32_t (*callback)(uint32_t, void *);
+    uint32_t trigger;
+} slot_t;
+
+static slot_t   slots[SLOTS_MAX];
+static uint8_t  slots_free;
+static uint32_t now;
+
+deferred_token defer_exec(uint32_t delay_ms, uint32_t (*callback)(uint32_t, void *), void *cb_arg) {
+    for (uint8_t i = 0; i < slots_free; i++) {
+        if (!slots[i].callback) {
+            slots[i] = (slot_t){callback, now + delay_ms};
+            return i + 1;
+        }
+    }
+    return INVALID_DEFERRED_TOKEN;
+}
+
+bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
+    slots[token - 1].trigger = now + delay_ms;
+    return true;
+}
+
+bool cancel_deferred_exec(deferred_token token) {
+    slots[token - 1].callback = NULL;
+    return true;
+}
+
+static bool pending(void) {
+    for (uint8_t i = 0; i < SLOTS_MAX; i++) {
+        if (slots[i].callback) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Runs the executor until it is idle; returns the milliseconds that took
+static uint32_t run(void) {
+    uint32_t start = now;
+    for (; pending(); now++) {
+        for (uint8_t i = 0; i < SLOTS_MAX; i++) {
+            if (slots[i].callback && slots[i].trigger == now) {
+                uint32_t delay = slots[i].callback(now, NULL);
+                if (delay) {
+                    slots[i].trigger = now + delay;
+                } else {
+                    slots[i].callback = NULL;
+                }
+            }
+        }
+    }
+    return now - start;
+}
+
+// Host side: keys and modifiers as reported, and what they typed
+static uint8_t  keys[KEYBOARD_REPORT_KEYS], key_count, weak_mods;
+static uint8_t  last_keys[KEYBOARD_REPORT_KEYS], last_count, last_mods;
+static char     typed[256];
+static uint8_t  typed_count;
+static uint32_t reports, mixed;
+
+uint8_t get_weak_mods(void) { return weak_mods; }
+void    add_weak_mods(uint8_t mods) { weak_mods |= mods; }
+void    clear_weak_mods(void) { weak_mods = 0; }
+
+void add_key(uint8_t keycode) { keys[key_count++] = keycode; }
+
+void del_key(uint8_t keycode) {
+    for (uint8_t i = 0; i < key_count; i++) {
+        if (keys[i] == keycode) {
+            keys[i] = keys[--key_count];
+            return;
+        }
+    }
+}
+
+static char decode(uint8_t keycode, bool shift) {
+    for (uint8_t c = 1; c < 128; c++) {
+        if (ascii_to_keycode_lut[c] == keycode && ascii_bit(ascii_to_shift_lut, c) == shift) {
+            return c;
+        }
+    }
+    return '?';
+}
+
+static bool was_down(uint8_t keycode) {
+    for (uint8_t i = 0; i < last_count; i++) {
+        if (last_keys[i] == keycode) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void send_keyboard_report(void) {
+    bool pressed = false;
+    for (uint8_t i = 0; i < key_count; i++) {
+        if (!was_down(keys[i])) {
+            typed[typed_count++] = decode(keys[i], weak_mods & MOD_BIT(KC_LSFT));
+            pressed              = true;
+        }
+    }
+    if (pressed && weak_mods != last_mods) {
+        mixed++;
+    }
+
+    memcpy(last_keys, keys, sizeof(keys));
+    last_count = key_count;
+    last_mods  = weak_mods;
+    reports++;
+}
+
+// Macro key steps show up as '#'
+void tap_code16(uint16_t keycode) {
+    typed[typed_count++] = '#';
+    reports += 2;
+}
+
+static void reset(uint8_t free) {
+    memset(typed, 0, sizeof(typed));
+    typed_count = 0;
+    reports     = 0;
+    mixed       = 0;
+    slots_free  = free;
+}
+
+static uint32_t send_string_reports(const char *str) {
+    uint32_t count = 0;
+    for (; *str; str++) {
+        count += ascii_bit(ascii_to_shift_lut, *str) ? 4 : 2;
+    }
+    return count;
+}
+
+static const char *samples[] = {
+    "```",
+    "Hello, world!",
+    "the quick brown fox jumps over the lazy dog",
+    "aaaa bbbb cccc",
+    "#include <stdio.h>\n",
+    "SHOUTING then WHISPERING",
+};
+
+MACRO_SEQ(code_macro, MACRO_TEXT("```", 0), {KC_ENT, 50, NULL}, MACRO_TEXT("```", 0));
+
+int main(void) {
+    int failures = 0;
+
+    printf("%-46s %5s %19s %18s\n", "string", "chars", "SEND_STRING rep/cps", "packed rep/cps");
+    for (uint8_t i = 0; i < ARRAY_SIZE(samples); i++) {
+        const char *str = samples[i];
+        size_t      len = strlen(str);
+
+        reset(1);
+        if (!packed_string_send(str)) {
+            failures++;
+            continue;
+        }
+        uint32_t ms   = run();
+        uint32_t base = send_string_reports(str);
+
+        if (typed_count != len || memcmp(typed, str, len) || mixed || key_queue_holding()) {
+            printf("%s: typed \"%s\", %u reports mixing mods and keys\n", str, typed, mixed);
+            failures++;
+        }
+        char label[47];
+        snprintf(label, sizeof(label), "\"%.*s\"", (int)strcspn(str, "\n"), str);
+        printf("%-46s %5zu %9u %9.0f %8u %9.0f\n", label, len, base, len * 1000.0 / base, reports, len * 1000.0 / ms);
+    }
+
+    // No executor: nothing is typed, and nothing is held
+    reset(0);
+    if (packed_string_send("abc") || run() || typed_count || key_queue_holding()) {
+        printf("no executor: string started\n");
+        failures++;
+    }
+    if (MACRO_SEQ_START(code_macro) || run() || typed_count || key_queue_holding()) {
+        printf("no executor: macro started, typed \"%s\"\n", typed);
+        failures++;
+    }
+
+    // Started soon: waits, holding keys, until an executor frees up
+    reset(0);
+    if (!MACRO_SEQ_START_SOON(code_macro) || MACRO_SEQ_START_SOON(code_macro) || !key_queue_holding()) {
+        printf("start soon: not waiting\n");
+        failures++;
+    }
+    slots_free = 1;
+    macro_seq_task();
+    run();
+    if (strcmp(typed, "```#```") || key_queue_holding()) {
+        printf("start soon: typed \"%s\"\n", typed);
+        failures++;
+    }
+
+    // One executor is enough for a whole macro, text steps included
+    reset(1);
+    if (!MACRO_SEQ_START(code_macro)) {
+        failures++;
+    }
+    run();
+    if (strcmp(typed, "```#```") || key_queue_holding()) {
+        printf("macro: typed \"%s\"\n", typed);
+        failures++;
+    }
+
+    // A text step waits for a string already in flight, then types whole
+    reset(2);
+    packed_string_send("abc");
+    MACRO_SEQ_START(code_macro);
+    run();
+    if (strcmp(typed, "abc```#```") || key_queue_holding()) {
+        printf("busy: typed \"%s\"\n", typed);
+        failures++;
+    }
+
+    printf("packed_string: %d failures\n", failures);
+    return failures != 0;
+}
@@ -0,0 +1,99 @@
+/**
+ * @file test_render_state.c
+ * @brief Two-thread check of the render_state snapshot channel
+ *
+ * The producer thread publishes snapshots whose fields are all derived from
+ * one counter; the consumer thread checks every snapshot it reads is whole
+ * (no fields from two different publishes) and that snapshots never go back.
+ * Snapshots published while nobody reads collapse into the newest one.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+
+#include "render_state.c"
+
+#define PUBLISHES 200000u
+
+layer_state_t layer_state;
+
+static uint32_t counter; // producer thread only
+
+uint8_t  get_highest_layer(layer_state_t state) { return counter & 0x0F; }
+uint8_t  get_mods(void) { return (counter >> 4) & 0xF0; }
+uint8_t  get_oneshot_mods(void) { return (counter >> 4) & 0x0F; }
+uint16_t wpm_stats_get_current(void) { return (uint16_t)(counter * 3); }
+uint16_t wpm_stats_get_average(void) { return (uint16_t)~counter; }
+uint32_t clock_now(void) { return counter; }
+
+static bool consistent(const render_state_t *s) {
+    uint32_t n = s->clock;
+    return s->layer == (n & 0x0F) && s->mods == ((n >> 4) & 0xFF) && s->wpm == (uint16_t)(n * 3) && s->wpm_avg == (uint16_t)~n;
+}
+
+static void *producer(void *arg) {
+    // The consumer finishes when it sees the last value, which latest-wins
+    // always leaves in the slot.
+    for (counter = 1; counter <= PUBLISHES; counter++) {
+        render_state_publish();
+        if (counter % 16 == 0) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static unsigned torn, backwards, reads;
+
+static void *consumer(void *arg) {
+    render_state_t state = {0};
+    uint32_t       last  = 0;
+    while (last != PUBLISHES) {
+        if (!render_state_consume(&state)) {
+            sched_yield();
+            continue;
+        }
+        reads++;
+        if (!consistent(&state)) {
+            torn++;
+        }
+        if (state.clock < last) {
+            backwards++;
+        }
+        last = state.clock;
+    }
+    return NULL;
+}
+
+int main(void) {
+    pthread_t p, c;
+    pthread_create(&c, NULL, consumer, NULL);
+    pthread_create(&p, NULL, producer, NULL);
+    pthread_join(p, NULL);
+    pthread_join(c, NULL);
+
+    printf("render_state: %u publishes, %u reads, %u torn, %u out of order\n", PUBLISHES, reads, torn, backwards);
+    if (torn || backwards || reads == 0) {
+        return 1;
+    }
+
+    // An unchanged snapshot is not published again.
+    render_state_t state;
+    counter = PUBLISHES;
+    render_state_publish();
+    if (render_state_consume(&state)) {
+        printf("render_state: unchanged snapshot was republished\n");
+        return 1;
+    }
+
+    // Nobody reading, as with the OLED off: the next read is the newest.
+    for (counter = PUBLISHES + 1; counter <= PUBLISHES + 100; counter++) {
+        render_state_publish();
+    }
+    if (!render_state_consume(&state) || state.clock != PUBLISHES + 100 || render_state_consume(&state)) {
+        printf("render_state: after a backlog read %u, expected %u\n", state.clock, PUBLISHES + 100);
+        return 1;
+    }
+    return 0;
+}